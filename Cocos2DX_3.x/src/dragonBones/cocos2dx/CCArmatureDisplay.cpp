@@ -66,6 +66,82 @@ void CCArmatureDisplay::removeEvent(const std::string& type, const std::function
 	_dispatcher->removeCustomEventListeners(type);
 }
 
+void CCArmatureDisplay::visit(cocos2d::Renderer* renderer, const cocos2d::Mat4& parentTransform, uint32_t parentFlags)
+{
+	if (!isVisible()) // Keep the update mode of setVisible(false), Node::visit() draws nothing.
+	{
+		return;
+	}
+
+	if ((_lodEnabled || _cullingEnabled) && _armature != nullptr && _armature->armatureData != nullptr)
+	{
+		const auto director = cocos2d::Director::getInstance();
+		const auto& aabb = _armature->armatureData->aabb;
+		const auto& visibleSize = director->getVisibleSize();
+		const auto rect = cocos2d::RectApplyTransform(cocos2d::Rect(aabb.x, aabb.y, aabb.width, aabb.height), getNodeToWorldTransform());
+
+		if (_lodEnabled)
+		{
+			const auto screenSize = std::max(rect.size.width / visibleSize.width, rect.size.height / visibleSize.height);
+			_armature->setLODScreenSize(screenSize);
+		}
+
+		if (_cullingEnabled)
+		{
+			const auto isOnScreen = rect.intersectsRect(cocos2d::Rect(director->getVisibleOrigin(), visibleSize));
+			const auto updateMode = isOnScreen ? ArmatureUpdateMode::Full : ArmatureUpdateMode::TimeOnly;
+			if (_armature->getUpdateMode() != updateMode)
+			{
+				_armature->setUpdateMode(updateMode);
+				if (isOnScreen) // Catch up before drawing.
+				{
+					_armature->advanceTime(0.0f);
+				}
+			}
+		}
+	}
+
+	cocos2d::Node::visit(renderer, parentTransform, parentFlags);
+}
+
+void CCArmatureDisplay::setLODEnabled(bool value)
+{
+	if (_lodEnabled == value)
+	{
+		return;
+	}
+
+	_lodEnabled = value;
+	if (!_lodEnabled && _armature != nullptr)
+	{
+		_armature->setLODLevel(0);
+	}
+}
+
+void CCArmatureDisplay::setCullingEnabled(bool value)
+{
+	if (_cullingEnabled == value)
+	{
+		return;
+	}
+
+	_cullingEnabled = value;
+	if (_armature != nullptr)
+	{
+		_armature->setUpdateMode(_cullingEnabled && !isVisible() ? ArmatureUpdateMode::TimeOnly : ArmatureUpdateMode::Full);
+	}
+}
+
+void CCArmatureDisplay::setVisible(bool visible)
+{
+	cocos2d::Node::setVisible(visible);
+
+	if (_cullingEnabled && _armature != nullptr && !visible) // Become visible at the next visit.
+	{
+		_armature->setUpdateMode(ArmatureUpdateMode::TimeOnly);
+	}
+}
+
 DBCCSprite* DBCCSprite::create()
 {
 	DBCCSprite* sprite = new (std::nothrow) DBCCSprite();
@@ -19,11 +19,15 @@ public:
 	static CCArmatureDisplay* create();
 
 protected:
+	bool _lodEnabled;
+	bool _cullingEnabled;
 	Armature* _armature;
 	cocos2d::EventDispatcher* _dispatcher;
 
 protected:
 	CCArmatureDisplay() :
+		_lodEnabled(false),
+		_cullingEnabled(false),
 		_armature(nullptr),
 		_dispatcher(nullptr)
 	{
@@ -64,6 +68,34 @@ public:
 	*/
 	virtual void removeEvent(const std::string& type, const std::function<void(EventObject*)>& listener) override;
 	/**
+	* 绘制时根据骨架在屏幕上的尺寸设置 LOD 等级，并在骨架离开屏幕时停止更新姿势。
+	* @see dragonBones.Armature#setLODScreenSize()
+	* @see dragonBones.Armature#setUpdateMode()
+	*/
+	virtual void visit(cocos2d::Renderer* renderer, const cocos2d::Mat4& parentTransform, uint32_t parentFlags) override;
+	/**
+	* 是否根据屏幕尺寸自动设置 LOD 等级。
+	* @default false
+	*/
+	inline bool getLODEnabled() const
+	{
+		return _lodEnabled;
+	}
+	void setLODEnabled(bool value);
+	/**
+	* 是否在骨架不可见或离开屏幕时只推进动画时间，不更新姿势。
+	* @default false
+	*/
+	inline bool getCullingEnabled() const
+	{
+		return _cullingEnabled;
+	}
+	void setCullingEnabled(bool value);
+	/**
+	* @inheritDoc
+	*/
+	virtual void setVisible(bool visible) override;
+	/**
 	* @inheritDoc
 	*/
 	inline virtual bool hasEvent(const std::string& type) const override
@@ -117,6 +117,11 @@ Slot* CCFactory::_buildSlot(const BuildArmaturePackage& dataPackage, SlotData* s
     return slot;
 }
 
+std::size_t CCFactory::_getSlotClassTypeIndex() const
+{
+    return CCSlot::getTypeIndex();
+}
+
 DragonBonesData* CCFactory::loadDragonBonesData(const std::string& filePath, const std::string& dragonBonesName)
 {
     if (!dragonBonesName.empty())
@@ -147,6 +152,7 @@ DragonBonesData* CCFactory::loadDragonBonesData(const std::string& filePath, con
         memcpy(buffer, cocos2dData.getBytes(), cocos2dData.getSize());
         const auto data = parseDragonBonesData((char*)buffer, dragonBonesName, 1.0f / scale);
         data->buffer = (char*)buffer;
+        data->contentHash = AnimationCacheFile::getContentHash((char*)buffer, cocos2dData.getSize(), 1.0f / scale);
 
         return data;
     }
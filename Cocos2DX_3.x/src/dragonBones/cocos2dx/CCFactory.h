@@ -66,7 +66,12 @@ public:
             cocos2d::Director::getInstance()->getScheduler()->schedule(
                 [&](float passedTime)
                 {
+                    publishBakedAnimations();
                     _dragonBonesInstance->advanceTime(passedTime);
+#ifdef DRAGONBONES_PROFILE
+                    _dragonBonesInstance->endProfileFrame();
+                    TraceRecorder::endFrame();
+#endif
                 },
                 this, 0.0f, false, "dragonBonesClock"
             );
@@ -82,6 +87,7 @@ protected:
     virtual TextureAtlasData* _buildTextureAtlasData(TextureAtlasData* textureAtlasData, void* textureAtlas) const override;
     virtual Armature* _buildArmature(const BuildArmaturePackage& dataPackage) const override;
     virtual Slot* _buildSlot(const BuildArmaturePackage& dataPackage, SlotData* slotData, std::vector<DisplayData*>* displays, Armature& armature) const override;
+    virtual std::size_t _getSlotClassTypeIndex() const override;
 
 public:
     virtual DragonBonesData* loadDragonBonesData(const std::string& filePath, const std::string& name = "");
@@ -254,6 +254,8 @@ void CCSlot::_updateFrame()
 
 void CCSlot::_updateMesh() 
 {
+    DRAGONBONES_PROFILE_NAMED_SCOPE(_armature->_dragonBones, Mesh, name);
+
     const auto hasFFD = !_ffdVertices.empty();
     const auto meshData = _meshData;
     const auto weightData = meshData->weight;
@@ -4,6 +4,7 @@
 // core
 #include "core/DragonBones.h"
 #include "core/BaseObject.h"
+#include "core/TraceRecorder.h"
 
 // geom
 #include "geom/ColorTransform.h"
@@ -28,6 +29,8 @@
 
 // factories
 #include "factories/BaseFactory.h"
+#include "factories/AnimationBakeTask.h"
+#include "factories/AnimationCacheFile.h"
 
 // armature
 #include "armature/IArmatureDisplay.h"
@@ -93,6 +93,8 @@ void Animation::init(Armature* armature)
 
 void Animation::advanceTime(float passedTime)
 {
+    DRAGONBONES_PROFILE_SCOPE(_armature->_dragonBones, Animation);
+
     if (passedTime < 0.0f)
     {
         passedTime = -passedTime;
@@ -121,11 +123,13 @@ void Animation::advanceTime(float passedTime)
         else
         {
             const auto animationData = animationState->animationData;
-            const auto cacheFrameRate = animationData->cacheFrameRate;
+            const auto cacheFrameRate = _armature->_cacheDisabled ? 0.0f : animationData->cacheFrameRate;
             if (_animationDirty && cacheFrameRate > 0.0f) // Update cachedFrameIndices.
             {
                 _animationDirty = false;
+                _armature->_cacheAnimationData = animationData;
 
+                // Cache offsets are local to the animation data, bones and slots drop the previous offsets by the cache generation.
                 for (const auto bone : _armature->getBones())
                 {
                     bone->_cachedFrameIndices = animationData->getBoneCachedFrameIndices(bone->name);
@@ -103,6 +103,7 @@ void AnimationState::_advanceFadeTime(float passedTime)
             eventObject->armature = _armature;
             eventObject->animationState = this;
             _armature->_dragonBones->bufferEvent(eventObject);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
         }
     }
 
@@ -143,6 +144,7 @@ void AnimationState::_advanceFadeTime(float passedTime)
             eventObject->armature = _armature;
             eventObject->animationState = this;
             _armature->_dragonBones->bufferEvent(eventObject);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
         }
     }
 }
@@ -280,10 +282,14 @@ void AnimationState::init(Armature* parmature, AnimationData* panimationData, An
 
 void AnimationState::updateTimelines()
 {
-    std::map<std::string, std::vector<BoneTimelineState*>> boneTimelines;
+    DRAGONBONES_PROFILE_SCOPE(_armature->_dragonBones, UpdateTimelines);
+
+    // Name IDs belong to the dragonBones data, the copied animations of other data are found by name.
+    const auto isSameData = animationData->parent->parent == _armature->armatureData->parent;
+    std::map<unsigned, std::vector<BoneTimelineState*>> boneTimelines;
     for (const auto timeline : _boneTimelines) // Create bone timelines map.
     {
-        boneTimelines[timeline->bone->name].push_back(timeline);
+        boneTimelines[timeline->bone->boneData->nameId].push_back(timeline);
     }
 
     for (const auto bone : _armature->getBones()) 
@@ -294,15 +300,21 @@ void AnimationState::updateTimelines()
             continue;
         }
 
-        const auto timelineDatas = animationData->getBoneTimelines(timelineName);
-        const auto iterator = boneTimelines.find(timelineName);
+        const auto nameId = bone->boneData->nameId;
+        const auto timelineDatas = isSameData ? animationData->getBoneTimelinesByNameId(nameId) : animationData->getBoneTimelines(timelineName);
+        const auto iterator = boneTimelines.find(nameId);
         if (iterator != boneTimelines.end()) // Remove bone timeline from map.
         {
             boneTimelines.erase(iterator);
         }
         else // Create new bone timeline.
         {
-            const auto bonePose = _bonePoses.find(timelineName) != _bonePoses.end() ? _bonePoses[timelineName] : (_bonePoses[timelineName] = BaseObject::borrowObject<BonePose>());
+            auto& bonePose = _bonePoses[nameId];
+            if (bonePose == nullptr)
+            {
+                bonePose = BaseObject::borrowObject<BonePose>();
+            }
+
             if (timelineDatas != nullptr) 
             {
                 for (const auto timelineData : *timelineDatas) 
@@ -358,11 +370,11 @@ void AnimationState::updateTimelines()
         }
     }
 
-    std::map<std::string, std::vector<SlotTimelineState*>> slotTimelines;
+    std::map<unsigned, std::vector<SlotTimelineState*>> slotTimelines;
     std::vector<unsigned> ffdFlags;
     for (const auto timeline : _slotTimelines) // Create slot timelines map.
     {
-        slotTimelines[timeline->slot->name].push_back(timeline);
+        slotTimelines[timeline->slot->slotData->nameId].push_back(timeline);
     }
 
     for (const auto slot : _armature->getSlots())
@@ -373,9 +385,9 @@ void AnimationState::updateTimelines()
             continue;
         }
 
-        const auto& timelineName = slot->name;
-        const auto timelineDatas = animationData->getSlotTimeline(timelineName);
-        const auto iterator = slotTimelines.find(timelineName);
+        const auto nameId = slot->slotData->nameId;
+        const auto timelineDatas = isSameData ? animationData->getSlotTimelineByNameId(nameId) : animationData->getSlotTimeline(slot->name);
+        const auto iterator = slotTimelines.find(nameId);
         if (iterator != slotTimelines.end()) // Remove slot timeline from map.
         {
             slotTimelines.erase(iterator);
@@ -471,6 +483,8 @@ void AnimationState::updateTimelines()
 
 void AnimationState::advanceTime(float passedTime, float cacheFrameRate)
 {
+    DRAGONBONES_PROFILE_NAMED_SCOPE(_armature->_dragonBones, AnimationState, name);
+
     // Update fade time.
     if (_fadeState != 0 || _subFadeState != 0) 
     {
@@ -500,7 +514,8 @@ void AnimationState::advanceTime(float passedTime, float cacheFrameRate)
     }
 
     const auto isCacheEnabled = _fadeState == 0 && cacheFrameRate > 0.0f;
-    auto isUpdateTimeline = true;
+    const auto isPoseUpdate = _armature->_evaluatePose; // Skip pose timelines between LOD updates.
+    auto isUpdateTimeline = isPoseUpdate;
     auto isUpdateBoneTimeline = true;
     auto time = _time;
     _weightResult = weight * _fadeProgress;
@@ -513,12 +528,13 @@ void AnimationState::advanceTime(float passedTime, float cacheFrameRate)
         _actionTimeline->currentTime = (unsigned)(_actionTimeline->currentTime * internval) / internval;
     }
 
-    if (_zOrderTimeline != nullptr) // Update zOrder timeline.
+    if (_zOrderTimeline != nullptr && isPoseUpdate) // Update zOrder timeline.
     {
         _zOrderTimeline->update(time);
+        DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, timelineCount, 1);
     }
 
-    if (isCacheEnabled) // Update cache.
+    if (isCacheEnabled && isPoseUpdate) // Update cache.
     {
         const auto cacheFrameIndex = (unsigned)(_actionTimeline->currentTime * cacheFrameRate); // uint
         if (_armature->_cacheFrameIndex == cacheFrameIndex) // Same cache.
@@ -585,6 +601,7 @@ void AnimationState::advanceTime(float passedTime, float cacheFrameRate)
                 if (bone != nullptr)
                 {
                     timeline->update(time);
+                    DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, timelineCount, 1);
                     if (i == l - 1)
                     {
                         _blendBoneTimline(timeline);
@@ -606,6 +623,7 @@ void AnimationState::advanceTime(float passedTime, float cacheFrameRate)
             }
 
             timeline->update(time);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, timelineCount, 1);
         }
     }
 
@@ -133,7 +133,7 @@ private:
     std::vector<std::string> _boneMask;
     std::vector<BoneTimelineState*> _boneTimelines;
     std::vector<SlotTimelineState*> _slotTimelines;
-    std::map<std::string, BonePose*> _bonePoses;
+    std::map<unsigned, BonePose*> _bonePoses;
     Armature* _armature;
     ZOrderTimelineState* _zOrderTimeline;
 
@@ -0,0 +1,77 @@
+#include "FixedStepWorldClock.h"
+#include "../armature/Armature.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+void FixedStepWorldClock::advanceTime(float passedTime)
+{
+    if (passedTime < 0.0f || passedTime != passedTime)
+    {
+        passedTime = 0.0f;
+    }
+
+    _stepCount = 0;
+
+    if (fixedTime <= 0.0f)
+    {
+        WorldClock::advanceTime(passedTime);
+        return;
+    }
+
+    _accumulatedTime += passedTime;
+
+    while (_accumulatedTime >= fixedTime)
+    {
+        if (_stepCount >= maxStepCount) // Drop the time can not catch up.
+        {
+            _accumulatedTime -= std::floor(_accumulatedTime / fixedTime) * fixedTime;
+            break;
+        }
+
+        _accumulatedTime -= fixedTime;
+        _stepCount++;
+
+        WorldClock::advanceTime(fixedTime);
+
+        for (std::size_t i = 0, l = _animatebles.size(); i < l; ++i)
+        {
+            const auto armature = dynamic_cast<Armature*>(_animatebles[i]);
+            if (
+                armature != nullptr &&
+                armature->getUpdateMode() == ArmatureUpdateMode::Full && // Invisible or culled armatures have no pose.
+                !armature->_isPoseRecording() // LOD interpolation records poses by itself.
+            )
+            {
+                armature->_recordPose();
+            }
+        }
+    }
+
+    if (interpolationEnabled)
+    {
+        interpolate(getAlpha());
+    }
+}
+
+void FixedStepWorldClock::interpolate(float alpha)
+{
+    if (alpha < 0.0f)
+    {
+        alpha = 0.0f;
+    }
+    else if (alpha > 1.0f)
+    {
+        alpha = 1.0f;
+    }
+
+    for (std::size_t i = 0, l = _animatebles.size(); i < l; ++i)
+    {
+        const auto armature = dynamic_cast<Armature*>(_animatebles[i]);
+        if (armature != nullptr && armature->getUpdateMode() == ArmatureUpdateMode::Full && !armature->_isPoseRecording())
+        {
+            armature->_interpolatePose(alpha);
+        }
+    }
+}
+
+DRAGONBONES_NAMESPACE_END
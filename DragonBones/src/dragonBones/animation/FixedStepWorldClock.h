@@ -0,0 +1,101 @@
+#ifndef DRAGONBONES_FIXED_STEP_WORLD_CLOCK_H
+#define DRAGONBONES_FIXED_STEP_WORLD_CLOCK_H
+
+#include "WorldClock.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * 固定步长的 WorldClock。
+ * 累积流逝的时间，按固定的步长为每个加入到时钟的 IAnimatable 对象更新时间，动画的更新频率与渲染的帧率无关。
+ * 渲染时可以在最近两次固定步长更新的骨骼姿势之间插值，而不需要重新计算时间轴。 (插值的姿势比最新的姿势延迟一个步长)
+ * @see dragonBones.WorldClock
+ * @version DragonBones 5.1
+ * @language zh_CN
+ */
+class FixedStepWorldClock : public WorldClock
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(FixedStepWorldClock)
+
+public:
+    /**
+     * 固定步长。 (以秒为单位)
+     * @default 1.0 / 30.0
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    float fixedTime;
+    /**
+     * 每次更新最多执行的步数，超出的时间将被丢弃，以免更新耗时过长时越来越慢。
+     * @default 4
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    unsigned maxStepCount;
+    /**
+     * 是否在每次更新后自动插值骨骼姿势。
+     * @default true
+     * @see #interpolate()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    bool interpolationEnabled;
+
+private:
+    unsigned _stepCount;
+    float _accumulatedTime;
+
+public:
+    /**
+     * 创建一个新的 FixedStepWorldClock 实例。
+     * @param pfixedTime 固定步长。 (以秒为单位)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    FixedStepWorldClock(float pfixedTime = 1.0f / 30.0f) :
+        WorldClock(),
+        fixedTime(pfixedTime),
+        maxStepCount(4),
+        interpolationEnabled(true),
+        _stepCount(0),
+        _accumulatedTime(0.0f)
+    {
+    }
+    virtual ~FixedStepWorldClock() {}
+    /**
+     * 累积时间并按固定步长更新。
+     * @param passedTime 前进的时间。 (以秒为单位)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    virtual void advanceTime(float passedTime) override;
+    /**
+     * 在最近两次固定步长更新的姿势之间插值骨骼的全局矩阵，并更新插槽。
+     * 骨骼的全局变换 (global) 保持最近一次更新的值，下一次固定步长更新前会恢复实际的姿势。
+     * @param alpha 插值的进度。 [0: 前一次更新的姿势, 1: 最近一次更新的姿势]
+     * @see #getAlpha()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    void interpolate(float alpha);
+    /**
+     * 累积的时间在当前步长中的进度。 [0~1)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    inline float getAlpha() const
+    {
+        return fixedTime > 0.0f ? _accumulatedTime / fixedTime : 0.0f;
+    }
+    /**
+     * 上一次更新执行的步数。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    inline unsigned getStepCount() const
+    {
+        return _stepCount;
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_FIXED_STEP_WORLD_CLOCK_H
@@ -33,7 +33,7 @@ void ActionTimelineState::_onCrossFrame(unsigned frameIndex) const
             {
                 if (action->slot != nullptr) 
                 {
-                    const auto slot = _armature->getSlot(action->slot->name);
+                    const auto slot = _armature->getSlotByNameId(action->slot->nameId);
                     if (slot != nullptr)
                     {
                         const auto childArmature = slot->getChildArmature();
@@ -74,15 +74,16 @@ void ActionTimelineState::_onCrossFrame(unsigned frameIndex) const
 
                     if (action->bone != nullptr)
                     {
-                        eventObject->bone = _armature->getBone(action->bone->name);
+                        eventObject->bone = _armature->getBoneByNameId(action->bone->nameId);
                     }
 
                     if (action->slot != nullptr)
                     {
-                        eventObject->slot = _armature->getSlot(action->slot->name);
+                        eventObject->slot = _armature->getSlotByNameId(action->slot->nameId);
                     }
 
                     _armature->_dragonBones->bufferEvent(eventObject);
+                    DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
                 }
             }
         }
@@ -116,6 +117,7 @@ void ActionTimelineState::update(float passedTime)
                     eventObject->armature = _armature;
                     eventObject->animationState = _animationState;
                     _armature->_dragonBones->bufferEvent(eventObject);
+                    DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
                 }
             }
             else 
@@ -191,6 +193,7 @@ void ActionTimelineState::update(float passedTime)
                             if (loopCompleteEvent != nullptr && crossedFrameIndex == 0) // Add loop complete event after first frame.
                             { 
                                 _armature->_dragonBones->bufferEvent(loopCompleteEvent);
+                                DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
                                 loopCompleteEvent = nullptr;
                             }
 
@@ -261,6 +264,7 @@ void ActionTimelineState::update(float passedTime)
                             if (loopCompleteEvent != nullptr && crossedFrameIndex == 0) // Add loop complete event before first frame.
                             {
                                 _armature->_dragonBones->bufferEvent(loopCompleteEvent);
+                                DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
                                 loopCompleteEvent = nullptr;
                             }
 
@@ -293,6 +297,7 @@ void ActionTimelineState::update(float passedTime)
                     if (!isReverse && loopCompleteEvent != nullptr) // Add loop complete event before first frame.
                     {
                         _armature->_dragonBones->bufferEvent(loopCompleteEvent);
+                        DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
                         loopCompleteEvent = nullptr;
                     }
 
@@ -304,11 +309,13 @@ void ActionTimelineState::update(float passedTime)
         if (loopCompleteEvent != nullptr)
         {
             _armature->_dragonBones->bufferEvent(loopCompleteEvent);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
         }
 
         if (completeEvent != nullptr)
         {
             _armature->_dragonBones->bufferEvent(completeEvent);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, eventCount, 1);
         }
     }
 }
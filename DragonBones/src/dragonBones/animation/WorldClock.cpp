@@ -1,11 +1,231 @@
 #include "WorldClock.h"
+#include "../core/ThreadPool.h"
+#include "../armature/Armature.h"
+#include "../armature/Slot.h"
+#include "../events/EventObject.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 
 WorldClock WorldClock::clock;
 
+WorldClock::~WorldClock()
+{
+    clear();
+
+    if (_threadPool != nullptr)
+    {
+        delete _threadPool;
+    }
+
+    for (const auto eventCollector : _eventCollectors)
+    {
+        if (this != &WorldClock::clock) // The pools of the main thread are destroyed before the static clock.
+        {
+            _releaseObjects(eventCollector);
+        }
+
+        delete eventCollector;
+    }
+}
+
+void WorldClock::_compact()
+{
+    if (_removedCount == 0)
+    {
+        return;
+    }
+
+    std::size_t r = 0;
+    for (std::size_t i = 0, l = _animatebles.size(); i < l; ++i)
+    {
+        const auto animatable = _animatebles[i];
+        if (animatable == nullptr)
+        {
+            r++;
+        }
+        else if (r > 0)
+        {
+            _animatebles[i - r] = animatable;
+            _animatableIndices[animatable] = i - r;
+        }
+    }
+
+    _animatebles.resize(_animatebles.size() - r);
+    _removedCount = 0;
+}
+
+void WorldClock::_releaseObjects(DragonBones* eventCollector)
+{
+    const auto objects = eventCollector->getObjects();
+    for (const auto object : *objects)
+    {
+        object->returnToPool();
+    }
+
+    objects->clear();
+}
+
+void WorldClock::_advanceTimeParallel(float passedTime)
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        _compact();
+        _tickAnimatables = _animatebles; // Animatables can be added or removed by the tasks.
+    }
+
+    const auto count = _tickAnimatables.size();
+    _tickArmatures.assign(count, nullptr);
+    while (_eventCollectors.size() < count)
+    {
+        _eventCollectors.push_back(new DragonBones());
+    }
+
+    // The merged events have been dispatched and returned to the pool of this thread,
+    // hand the same number back to each collector so the workers pool them again.
+    _eventCounts.resize(_eventCollectors.size(), 0);
+    for (std::size_t i = 0, l = _eventCollectors.size(); i < l; ++i)
+    {
+        const auto objects = _eventCollectors[i]->getObjects();
+        for (; _eventCounts[i] > 0; --_eventCounts[i])
+        {
+            objects->push_back(BaseObject::borrowObject<EventObject>());
+        }
+
+        if (i >= count)
+        {
+            _releaseObjects(_eventCollectors[i]);
+        }
+    }
+
+    // Group armatures by root armature, child armatures are updated with their parent.
+    std::unordered_map<const Armature*, unsigned> groupMap;
+    std::vector<unsigned> groups(count, 0);
+    _groupOffsets.clear();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto armature = dynamic_cast<Armature*>(_tickAnimatables[i]);
+        if (armature == nullptr || armature->_dragonBones == nullptr || !armature->_dragonBones->displayThreadSafe) // Update in the current thread.
+        {
+            continue;
+        }
+
+        const Armature* root = armature;
+        while (root->getParent() != nullptr && root->getParent()->getArmature() != nullptr)
+        {
+            root = root->getParent()->getArmature();
+        }
+
+        if (root->getCacheFrameRate() > 0) // Cached armatures share the cache data, update them in one group.
+        {
+            root = nullptr;
+        }
+
+        const auto iterator = groupMap.find(root);
+        if (iterator != groupMap.end())
+        {
+            groups[i] = iterator->second;
+        }
+        else
+        {
+            groups[i] = (unsigned)_groupOffsets.size();
+            groupMap[root] = groups[i];
+            _groupOffsets.push_back(0);
+        }
+
+        _tickArmatures[i] = armature;
+        _groupOffsets[groups[i]]++;
+    }
+
+    const auto groupCount = (unsigned)_groupOffsets.size();
+    std::vector<unsigned> groupCursors(groupCount, 0);
+    for (unsigned i = 0, offset = 0; i < groupCount; ++i) // Counts to offsets.
+    {
+        groupCursors[i] = offset;
+        offset += _groupOffsets[i];
+        _groupOffsets[i] = groupCursors[i];
+    }
+
+    _groupIndices.resize(count);
+    for (std::size_t i = 0; i < count; ++i) // Registration order in each group.
+    {
+        if (_tickArmatures[i] != nullptr)
+        {
+            _groupIndices[groupCursors[groups[i]]++] = (unsigned)i;
+        }
+    }
+
+    _groupOffsets.push_back(groupCount > 0 ? groupCursors[groupCount - 1] : 0);
+
+    const auto taskSize = std::max(groupCount / ((_threadPool->getThreadCount() + 1) * 4), 1u);
+    const auto taskCount = (groupCount + taskSize - 1) / taskSize;
+    const std::function<void(unsigned)> task = [&](unsigned taskIndex)
+    {
+        for (unsigned i = taskIndex * taskSize, l = std::min(i + taskSize, groupCount); i < l; ++i)
+        {
+            for (auto j = _groupOffsets[i], k = _groupOffsets[i + 1]; j < k; ++j)
+            {
+                const auto index = _groupIndices[j];
+                const auto armature = _tickArmatures[index];
+                _releaseObjects(_eventCollectors[index]); // Objects of the last update return to the pool of this thread.
+                std::swap(armature->_dragonBones, _eventCollectors[index]); // Buffer events and objects.
+                armature->advanceTime(passedTime);
+            }
+        }
+    };
+    _threadPool->run(taskCount, task);
+
+    for (std::size_t i = 0; i < count; ++i) // Merge in registration order.
+    {
+        const auto armature = _tickArmatures[i];
+        if (armature == nullptr)
+        {
+            _releaseObjects(_eventCollectors[i]);
+            _tickAnimatables[i]->advanceTime(passedTime);
+            continue;
+        }
+
+        std::swap(armature->_dragonBones, _eventCollectors[i]);
+
+        const auto dragonBones = armature->_dragonBones;
+        const auto eventCollector = _eventCollectors[i];
+        const auto events = eventCollector->getEvents();
+        const auto objects = eventCollector->getObjects();
+        for (const auto eventObject : *events)
+        {
+            dragonBones->bufferEvent(eventObject);
+        }
+
+        // Other objects are kept and returned by a worker at the next update, after the events have been dispatched.
+        std::size_t keptCount = 0;
+        for (const auto object : *objects)
+        {
+            if (dynamic_cast<Armature*>(object) != nullptr) // Disposed armatures are released with their displays in the current thread.
+            {
+                dragonBones->bufferObject(object);
+            }
+            else
+            {
+                (*objects)[keptCount++] = object;
+            }
+        }
+
+        _eventCounts[i] = (unsigned)events->size();
+        events->clear();
+        objects->resize(keptCount);
+
+#ifdef DRAGONBONES_PROFILE
+        dragonBones->_profileStats.add(eventCollector->_profileStats);
+        eventCollector->_profileStats.clear();
+#endif
+    }
+
+    _tickAnimatables.clear();
+}
+
 void WorldClock::advanceTime(float passedTime)
 {
+    DRAGONBONES_PROFILE_TRACE_SCOPE(Clock);
+
     if (passedTime < 0.0f || passedTime != passedTime)
     {
         passedTime = 0.0f;
@@ -30,6 +250,16 @@ void WorldClock::advanceTime(float passedTime)
         return;
     }
 
+    if (_threadPool != nullptr && !ThreadPool::isInTask())
+    {
+        _isAdvancing = true;
+        _advanceTimeParallel(passedTime);
+        _isAdvancing = false;
+        return;
+    }
+
+    _isAdvancing = true;
+
     std::size_t i = 0, r = 0, l = _animatebles.size();
     for (; i < l; ++i)
     {
@@ -40,6 +270,7 @@ void WorldClock::advanceTime(float passedTime)
             {
                 _animatebles[i - r] = animatable;
                 _animatebles[i] = nullptr;
+                _animatableIndices[animatable] = i - r;
             }
 
             animatable->advanceTime(passedTime);
@@ -59,6 +290,7 @@ void WorldClock::advanceTime(float passedTime)
             if (animateble != nullptr)
             {
                 _animatebles[i - r] = animateble;
+                _animatableIndices[animateble] = i - r;
             }
             else
             {
@@ -67,18 +299,29 @@ void WorldClock::advanceTime(float passedTime)
         }
 
         _animatebles.resize(l - r);
+        _removedCount -= r;
     }
+
+    _isAdvancing = false;
 }
 
 bool WorldClock::contains(const IAnimatable* value) const
 {
-    return std::find(_animatebles.cbegin(), _animatebles.cend(), value) != _animatebles.cend();
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _animatableIndices.find(value) != _animatableIndices.cend();
 }
 
 void WorldClock::add(IAnimatable* value)
 {
-    if (std::find(_animatebles.begin(), _animatebles.end(), value) == _animatebles.end())
+    std::lock_guard<std::recursive_mutex> lock(_mutex); // Tasks of the parallel update can add child armatures.
+    if (_animatableIndices.find(value) == _animatableIndices.end())
     {
+        if (!_isAdvancing && _removedCount > _animatebles.size() / 2) // Compact tombstones if the clock is not advancing.
+        {
+            _compact();
+        }
+
+        _animatableIndices[value] = _animatebles.size();
         _animatebles.push_back(value);
         value->setClock(this);
     }
@@ -86,16 +329,20 @@ void WorldClock::add(IAnimatable* value)
 
 void WorldClock::remove(IAnimatable* value)
 {
-    const auto iterator = std::find(_animatebles.begin(), _animatebles.end(), value);
-    if (iterator != _animatebles.end())
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    const auto iterator = _animatableIndices.find(value);
+    if (iterator != _animatableIndices.end())
     {
-        *iterator = nullptr;
+        _animatebles[iterator->second] = nullptr; // Tombstone, safe to remove in advanceTime().
+        _animatableIndices.erase(iterator);
+        _removedCount++;
         value->setClock(nullptr);
     }
 }
 
 void WorldClock::clear()
 {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
     for (const auto animatable : _animatebles)
     {
         if (animatable != nullptr)
@@ -105,6 +352,37 @@ void WorldClock::clear()
     }
 }
 
+unsigned WorldClock::getThreadCount() const
+{
+    return _threadPool != nullptr ? _threadPool->getThreadCount() : 0;
+}
+
+void WorldClock::setThreadCount(unsigned value)
+{
+    if (getThreadCount() == value)
+    {
+        return;
+    }
+
+    if (_threadPool != nullptr)
+    {
+        delete _threadPool;
+        _threadPool = nullptr;
+    }
+
+    for (const auto eventCollector : _eventCollectors) // Release the kept objects in the current thread.
+    {
+        _releaseObjects(eventCollector);
+    }
+
+    _eventCounts.clear();
+
+    if (value > 0)
+    {
+        _threadPool = new ThreadPool(value);
+    }
+}
+
 void WorldClock::setClock(WorldClock* value)
 {
     if (_clock == value)
@@ -39,9 +39,22 @@ public:
      */
     float timeScale;
 
-private:
+protected:
     std::vector<IAnimatable*> _animatebles;
+
+private:
+    bool _isAdvancing;
+    std::size_t _removedCount;
+    std::unordered_map<const IAnimatable*, std::size_t> _animatableIndices;
     WorldClock* _clock;
+    ThreadPool* _threadPool;
+    mutable std::recursive_mutex _mutex;
+    std::vector<IAnimatable*> _tickAnimatables;
+    std::vector<Armature*> _tickArmatures;
+    std::vector<DragonBones*> _eventCollectors;
+    std::vector<unsigned> _eventCounts;
+    std::vector<unsigned> _groupOffsets;
+    std::vector<unsigned> _groupIndices;
 
 public:
     /**
@@ -55,17 +68,32 @@ public:
         time(ptime),
         timeScale(1.0f),
         _animatebles(),
-        _clock(nullptr)
+        _isAdvancing(false),
+        _removedCount(0),
+        _animatableIndices(),
+        _clock(nullptr),
+        _threadPool(nullptr),
+        _mutex(),
+        _tickAnimatables(),
+        _tickArmatures(),
+        _eventCollectors(),
+        _eventCounts(),
+        _groupOffsets(),
+        _groupIndices()
     {
         if (time < 0.0f)
         {
             time = 0.0f;
         }
     }
-    virtual ~WorldClock()
-    {
-        clear();
-    }
+    virtual ~WorldClock();
+
+private:
+    void _compact();
+    void _releaseObjects(DragonBones* eventCollector);
+    void _advanceTimeParallel(float passedTime);
+
+public:
     /**
      * 为所有的 IAnimatable 实例更新时间。
      * @param passedTime 前进的时间。 (以秒为单位，当设置为 -1 时将自动计算当前帧与上一帧的时间差)
@@ -108,6 +136,20 @@ public:
         return _clock;
     }
     virtual void setClock(WorldClock* value) override;
+    /**
+     * 并行更新使用的工作线程数量。
+     * 并行更新时，骨架按根骨架分组 (子骨架与父骨架在同一组)，每组在一个线程中按加入顺序更新。
+     * 更新中产生的事件先缓存在每个骨架的事件缓冲区中，更新结束后按加入顺序合并，因此事件顺序与串行更新相同。
+     * 工作线程中回收的对象 (事件和动画状态等) 在下一次更新时返还工作线程的对象池，以免对象在线程之间迁移。
+     * 开启了动画缓存的骨架共享缓存数据，全部在同一组中更新。 不是骨架的 IAnimatable 实例在合并时于当前线程中更新。
+     * 只有后端的显示对象可以在工作线程中更新时 (DragonBones::displayThreadSafe，例如 Headless 后端) 骨架才并行更新，
+     * 否则 (例如 Cocos2d-x 后端，节点和纹理只能在主线程中修改) 骨架也在合并时于当前线程中更新。
+     * @default 0 (在当前线程中串行更新)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    unsigned getThreadCount() const;
+    void setThreadCount(unsigned value);
 
 public: // For WebAssembly.
     static WorldClock* getStaticClock() { return &WorldClock::clock; }
@@ -1,4 +1,5 @@
 #include "Armature.h"
+#include "../model/DragonBonesData.h"
 #include "../model/TextureAtlasData.h"
 #include "../model/UserData.h"
 #include "../animation/WorldClock.h"
@@ -11,6 +12,8 @@
 
 DRAGONBONES_NAMESPACE_BEGIN
 
+std::vector<float> Armature::LOD_SCREEN_SIZES = { 0.2f, 0.1f, 0.05f };
+
 int Armature::_onSortSlots(Slot* a, Slot* b)
 {
     return a->_zOrder > b->_zOrder ? true : false;
@@ -50,6 +53,7 @@ void Armature::_onClear()
 
     inheritAnimation = true;
     debugDraw = false;
+    lodInterpolationEnabled = false;
     armatureData = nullptr;
     userData = nullptr;
 
@@ -60,9 +64,22 @@ void Armature::_onClear()
     _zOrderDirty = false;
     _flipX = false;
     _flipY = false;
+    _evaluatePose = true;
+    _lodInterpolated = false;
+    _updateMode = ArmatureUpdateMode::Full;
+    _lodLevel = 0;
+    _lodTick = 0;
     _cacheFrameIndex = -1;
+    _cacheAnimationData = nullptr;
+    _cacheDisabled = false;
+    _updatedBoneCount = 0;
+    _updatedSlotCount = 0;
     _bones.clear();
     _slots.clear();
+    _bonesByNameId.clear();
+    _slotsByNameId.clear();
+    _poseBuffer.clear();
+    _lodPoses.clear();
     _dragonBones = nullptr;
     _animation = nullptr;
     _proxy = nullptr;
@@ -75,59 +92,239 @@ void Armature::_onClear()
 
 void Armature::_sortBones()
 {
+    _lodPoses.clear();
+
     const auto total = _bones.size();
     if (total <= 0) 
     {
+        _poseBuffer.clear();
         return;
     }
 
-    auto sortHelper = _bones; // Copy
-    unsigned index = 0;
-    unsigned count = 0;
-
-    _bones.resize(0);
+    const auto& sortedBones = armatureData->sortedBones;
+    auto isSorted = total == sortedBones.size();
+    for (std::size_t i = 0; isSorted && i < total; ++i)
+    {
+        isSorted = _bones[i]->boneData == sortedBones[i];
+    }
 
-    while (count < total) 
+    if (!isSorted) // Bones has been added or removed, sort by self.
     {
-        auto bone = sortHelper[index++];
-        if (index >= total) 
+        for (std::size_t i = 0; i < total; ++i)
         {
-            index = 0;
+            _bones[i]->_poseIndex = i;
         }
 
-        if (std::find(_bones.cbegin(), _bones.cend(), bone) != _bones.cend()) 
+        // Linear topological sort, the parent and the constraint targets of a bone are sorted before it.
+        std::vector<unsigned> dependencyCounts(total, 0);
+        std::vector<std::vector<Bone*>> dependents(total);
+        for (const auto bone : _bones)
         {
-            continue;
+            const auto parent = bone->getParent();
+            if (parent != nullptr && parent->getArmature() == this)
+            {
+                dependencyCounts[bone->_poseIndex]++;
+                dependents[parent->_poseIndex].push_back(bone);
+            }
+
+            for (const auto constraint : bone->constraints)
+            {
+                const auto target = constraint->target;
+                if (target != nullptr && target->getArmature() == this)
+                {
+                    dependencyCounts[bone->_poseIndex]++;
+                    dependents[target->_poseIndex].push_back(bone);
+                }
+            }
         }
 
-        if (bone->constraints.size() > 0) // Wait constraint.
+        std::vector<Bone*> sortHelper;
+        sortHelper.reserve(total);
+        for (const auto bone : _bones)
         {
-            auto flag = false;
-            for (const auto constraint : bone->constraints) 
+            if (dependencyCounts[bone->_poseIndex] == 0)
             {
-                if (std::find(_bones.cbegin(), _bones.cend(), constraint->target) == _bones.cend()) 
+                sortHelper.push_back(bone);
+            }
+        }
+
+        for (std::size_t i = 0; i < sortHelper.size(); ++i)
+        {
+            for (const auto dependent : dependents[sortHelper[i]->_poseIndex])
+            {
+                if (--dependencyCounts[dependent->_poseIndex] == 0)
                 {
-                    flag = true;
-                    break;
+                    sortHelper.push_back(dependent);
                 }
             }
+        }
 
-            if(flag)
+        if (sortHelper.size() < total)
+        {
+            DRAGONBONES_ASSERT(false, "Bone dependencies are circular.");
+
+            for (const auto bone : _bones)
             {
-                continue;
+                if (dependencyCounts[bone->_poseIndex] > 0)
+                {
+                    sortHelper.push_back(bone);
+                }
             }
         }
 
-        if (bone->getParent() != nullptr && std::find(_bones.cbegin(), _bones.cend(), bone->getParent()) == _bones.cend()) // Wait parent.
+        _bones.swap(sortHelper);
+    }
+
+    _updatePoseBuffer();
+}
+
+void Armature::_updatePoseBuffer()
+{
+    const auto count = _bones.size();
+    auto& pose = _poseBuffer;
+    pose.resize(count);
+    pose.batched = true;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto bone = _bones[i];
+        bone->_poseIndex = i;
+        pose.bones[i] = bone;
+        pose.dirtyFlags[i] = PoseBuffer::CLEAN;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto bone = _bones[i];
+        const auto parent = bone->getParent();
+        pose.parentIndices[i] = parent != nullptr ? parent->_poseIndex : -1;
+
+        if (
+            !bone->constraints.empty() ||
+            !bone->boneData->inheritTranslation ||
+            !bone->boneData->inheritRotation ||
+            !bone->boneData->inheritScale
+        ) // Constraints and partial inherit need the parent's global transform, update bone by bone.
+        {
+            pose.batched = false;
+        }
+    }
+}
+
+void Armature::_updatePose()
+{
+    DRAGONBONES_PROFILE_SCOPE(_dragonBones, Bones);
+
+    auto& pose = _poseBuffer;
+    const auto& bones = pose.bones;
+
+    for (const auto bone : bones)
+    {
+        if (bone->_isClean()) // Skip the bone and its clean children.
         {
+            pose.setWorld(bone->_poseIndex, bone->globalTransformMatrix);
+            pose.dirtyFlags[bone->_poseIndex] = PoseBuffer::CLEAN;
             continue;
         }
 
-        _bones.push_back(bone);
-        count++;
+        bone->_updatePose(pose);
+        _updatedBoneCount++;
+    }
+
+    DRAGONBONES_PROFILE_COUNT(_dragonBones, boneUpdateCount, _updatedBoneCount);
+
+    pose.updateWorldMatrices();
+
+    for (const auto bone : bones)
+    {
+        bone->_applyPose(pose);
     }
 }
 
+bool Armature::_isPoseRecording() const
+{
+    return _updateMode == ArmatureUpdateMode::Full && lodInterpolationEnabled && _lodLevel > 0;
+}
+
+void Armature::_recordPose()
+{
+    if (_lodInterpolated) // Bones were not evaluated since the last interpolation, record the last evaluated pose.
+    {
+        _lodInterpolated = false;
+        _restorePose();
+    }
+
+    const auto count = _bones.size();
+    if (_lodPoses.size() != count * 2) // The first half is the previous pose, the second half is the current pose.
+    {
+        _lodPoses.resize(count * 2);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            _lodPoses[i] = _bones[i]->globalTransformMatrix;
+            _lodPoses[count + i] = _bones[i]->globalTransformMatrix;
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            _lodPoses[i] = _lodPoses[count + i];
+            _lodPoses[count + i] = _bones[i]->globalTransformMatrix;
+        }
+    }
+}
+
+void Armature::_restorePose()
+{
+    const auto count = _bones.size();
+    if (_lodPoses.size() != count * 2)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        _bones[i]->globalTransformMatrix = _lodPoses[count + i];
+    }
+}
+
+void Armature::_interpolatePose(float progress)
+{
+    const auto count = _bones.size();
+    if (_lodPoses.size() != count * 2)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& prev = _lodPoses[i];
+        const auto& curr = _lodPoses[count + i];
+        const auto bone = _bones[i];
+        auto& matrix = bone->globalTransformMatrix;
+        matrix.a = prev.a + (curr.a - prev.a) * progress;
+        matrix.b = prev.b + (curr.b - prev.b) * progress;
+        matrix.c = prev.c + (curr.c - prev.c) * progress;
+        matrix.d = prev.d + (curr.d - prev.d) * progress;
+        matrix.tx = prev.tx + (curr.tx - prev.tx) * progress;
+        matrix.ty = prev.ty + (curr.ty - prev.ty) * progress;
+        bone->_childrenTransformDirty = true; // Update slots.
+    }
+
+    for (const auto slot : _slots)
+    {
+        slot->update(-1);
+        _updatedSlotCount++;
+    }
+
+    for (const auto bone : _bones)
+    {
+        bone->_childrenTransformDirty = false;
+    }
+
+    _lodInterpolated = true; // Restore before the next evaluation.
+}
+
 void Armature::_sortSlots()
 {
     std::sort(_slots.begin(), _slots.end(), Armature::_onSortSlots);
@@ -149,7 +346,7 @@ void Armature::_sortZOrder(int16_t* slotIndices, unsigned offset)
             }
 
             const auto slotData = slotDatas[slotIndex];
-            const auto slot = getSlot(slotData->name);
+            const auto slot = getSlotByNameId(slotData->nameId);
             if (slot != nullptr) 
             {
                 slot->_setZorder(i);
@@ -161,10 +358,34 @@ void Armature::_sortZOrder(int16_t* slotIndices, unsigned offset)
     }
 }
 
+int Armature::_getNameId(const std::string& name) const
+{
+    if (armatureData == nullptr || armatureData->parent == nullptr)
+    {
+        return -1;
+    }
+
+    return armatureData->parent->getNameId(name);
+}
+
 void Armature::_addBoneToBoneList(Bone* value)
 {
     if (std::find(_bones.begin(), _bones.end(), value) == _bones.end())
     {
+        const auto nameId = _getNameId(value->name);
+        if (nameId >= 0)
+        {
+            if ((std::size_t)nameId >= _bonesByNameId.size())
+            {
+                _bonesByNameId.resize(nameId + 1, nullptr);
+            }
+
+            if (_bonesByNameId[nameId] == nullptr)
+            {
+                _bonesByNameId[nameId] = value;
+            }
+        }
+
         _bonesDirty = true;
         _bones.push_back(value);
         _animation->_timelineDirty = true;
@@ -176,6 +397,13 @@ void Armature::_removeBoneFromBoneList(Bone* value)
     const auto iterator = std::find(_bones.begin(), _bones.end(), value);
     if (iterator != _bones.end())
     {
+        const auto nameIterator = std::find(_bonesByNameId.begin(), _bonesByNameId.end(), value);
+        if (nameIterator != _bonesByNameId.end())
+        {
+            *nameIterator = nullptr;
+        }
+
+        _bonesDirty = true; // Update pose buffer.
         _bones.erase(iterator);
         _animation->_timelineDirty = true;
     }
@@ -185,6 +413,20 @@ void Armature::_addSlotToSlotList(Slot* value)
 {
     if (std::find(_slots.begin(), _slots.end(), value) == _slots.end())
     {
+        const auto nameId = _getNameId(value->name);
+        if (nameId >= 0)
+        {
+            if ((std::size_t)nameId >= _slotsByNameId.size())
+            {
+                _slotsByNameId.resize(nameId + 1, nullptr);
+            }
+
+            if (_slotsByNameId[nameId] == nullptr)
+            {
+                _slotsByNameId[nameId] = value;
+            }
+        }
+
         _slotsDirty = true;
         _slots.push_back(value);
         _animation->_timelineDirty = true;
@@ -196,6 +438,12 @@ void Armature::_removeSlotFromSlotList(Slot* value)
     const auto iterator = std::find(_slots.begin(), _slots.end(), value);
     if (iterator != _slots.end())
     {
+        const auto nameIterator = std::find(_slotsByNameId.begin(), _slotsByNameId.end(), value);
+        if (nameIterator != _slotsByNameId.end())
+        {
+            *nameIterator = nullptr;
+        }
+
         _slots.erase(iterator);
         _animation->_timelineDirty = true;
     }
@@ -246,7 +494,18 @@ void Armature::advanceTime(float passedTime)
         return;
     }
 
+    DRAGONBONES_PROFILE_NAMED_SCOPE(_dragonBones, Armature, armatureData->name);
+
     const auto prevCacheFrameIndex = _cacheFrameIndex;
+    const auto lodInterval = 1u << _lodLevel;
+    const auto isFullUpdate = _updateMode == ArmatureUpdateMode::Full;
+    const auto isInterpolated = _isPoseRecording();
+
+    _evaluatePose = isFullUpdate && (_lodTick == 0 || passedTime == 0.0f);
+    if (_evaluatePose)
+    {
+        _lodTick = 0;
+    }
 
     _animation->advanceTime(passedTime);
 
@@ -263,17 +522,74 @@ void Armature::advanceTime(float passedTime)
         _sortSlots();
     }
 
-    if (_cacheFrameIndex < 0 || _cacheFrameIndex != prevCacheFrameIndex)
+    _updatedBoneCount = 0;
+    _updatedSlotCount = 0;
+
+    // Bones hold the interpolated pose, restore the last evaluated pose even if the cache frame does not change.
+    const auto isRestored = _evaluatePose && _lodInterpolated;
+    if (isRestored)
     {
-        for (const auto bone : _bones)
+        _lodInterpolated = false;
+        _restorePose();
+    }
+
+    if (_evaluatePose && (_cacheFrameIndex < 0 || _cacheFrameIndex != prevCacheFrameIndex || isRestored))
+    {
+        const auto isCache = _cacheFrameIndex >= 0;
+
+        if (!isCache && _poseBuffer.batched)
         {
-            bone->update(_cacheFrameIndex);
+            _updatePose();
         }
+        else
+        {
+            DRAGONBONES_PROFILE_SCOPE(_dragonBones, Bones);
 
-        for (const auto slot : _slots)
+            for (const auto bone : _bones)
+            {
+                if (!isCache && bone->_isClean()) // Skip the bone and its clean children.
+                {
+                    continue;
+                }
+
+                bone->update(_cacheFrameIndex);
+                _updatedBoneCount++;
+            }
+        }
+
+        if (isInterpolated)
         {
-            slot->update(_cacheFrameIndex);
+            _recordPose();
         }
+        else
+        {
+            DRAGONBONES_PROFILE_SCOPE(_dragonBones, Slots);
+
+            for (const auto slot : _slots)
+            {
+                if (isRestored)
+                {
+                    slot->invalidUpdate();
+                }
+                else if (!isCache && slot->_isClean())
+                {
+                    continue;
+                }
+
+                slot->update(_cacheFrameIndex);
+                _updatedSlotCount++;
+            }
+        }
+    }
+
+    if (isInterpolated) // Displayed pose is one interval behind the evaluated pose.
+    {
+        _interpolatePose((float)_lodTick / lodInterval);
+    }
+
+    if (isFullUpdate && passedTime > 0.0f)
+    {
+        _lodTick = (_lodTick + 1) % lodInterval;
     }
 
     const auto drawed = debugDraw || DragonBones::debugDraw;
@@ -284,6 +600,64 @@ void Armature::advanceTime(float passedTime)
     }
 }
 
+void Armature::setLODLevel(unsigned value)
+{
+    if (value > 4)
+    {
+        value = 4;
+    }
+
+    if (_lodLevel == value)
+    {
+        return;
+    }
+
+    _lodLevel = value;
+    _lodTick = 0;
+}
+
+void Armature::setLODScreenSize(float value)
+{
+    unsigned level = 0;
+    for (const auto screenSize : LOD_SCREEN_SIZES)
+    {
+        if (value >= screenSize)
+        {
+            break;
+        }
+
+        level++;
+    }
+
+    setLODLevel(level);
+}
+
+void Armature::setUpdateMode(ArmatureUpdateMode value)
+{
+    if (_updateMode == value)
+    {
+        return;
+    }
+
+    _updateMode = value;
+
+    if (_updateMode == ArmatureUpdateMode::Full) // Catch up, evaluate the whole pose at the next update.
+    {
+        _lodTick = 0;
+        _lodPoses.clear(); // The recorded poses are stale, record again from the current pose.
+        invalidUpdate("", true);
+    }
+
+    for (const auto slot : _slots) // Child armatures are advanced by the clock.
+    {
+        const auto childArmature = slot->getChildArmature();
+        if (childArmature != nullptr)
+        {
+            childArmature->setUpdateMode(value);
+        }
+    }
+}
+
 void Armature::invalidUpdate(const std::string& boneName, bool updateSlotDisplay)
 {
     if (!boneName.empty())
@@ -438,7 +812,17 @@ Slot* Armature::intersectsSegment(
 
 Bone* Armature::getBone(const std::string& name) const
 {
-    for (const auto& bone : _bones)
+    const auto nameId = _getNameId(name);
+    if (nameId >= 0)
+    {
+        const auto bone = getBoneByNameId(nameId);
+        if (bone != nullptr && bone->name == name)
+        {
+            return bone;
+        }
+    }
+
+    for (const auto& bone : _bones) // Bones renamed or not in the data.
     {
         if (bone->name == name)
         {
@@ -458,7 +842,17 @@ Bone* Armature::getBoneByDisplay(void* display) const
 
 Slot* Armature::getSlot(const std::string& name) const
 {
-    for (const auto slot : _slots)
+    const auto nameId = _getNameId(name);
+    if (nameId >= 0)
+    {
+        const auto slot = getSlotByNameId(nameId);
+        if (slot != nullptr && slot->name == name)
+        {
+            return slot;
+        }
+    }
+
+    for (const auto slot : _slots) // Slots renamed or not in the data.
     {
         if (slot->name == name)
         {
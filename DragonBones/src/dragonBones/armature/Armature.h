@@ -5,6 +5,7 @@
 #include "../animation/IAnimatable.h"
 #include "../model/ArmatureData.h"
 #include "IArmatureProxy.h"
+#include "PoseBuffer.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 /**
@@ -20,6 +21,15 @@ class Armature : public virtual IAnimatable, public BaseObject
 {
     BIND_CLASS_TYPE_B(Armature);
 
+public:
+    /**
+     * 每个 LOD 等级的最小屏幕尺寸，屏幕尺寸小于所有值时使用最大的 LOD 等级。
+     * @see #setLODScreenSize()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static std::vector<float> LOD_SCREEN_SIZES;
+
 private:
     static int _onSortSlots(Slot* a, Slot* b);
 
@@ -35,6 +45,15 @@ public:
      * @private
      */
     bool debugDraw; // TODO
+    /**
+     * 是否在两次姿势更新之间对骨骼的全局矩阵进行线性插值，否则保持上一次的姿势。 (LOD 等级大于 0 时有效)
+     * 插值的姿势比实际姿势延迟一个更新间隔，动画时间和帧事件不受影响。
+     * @default false
+     * @see #setLODLevel()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    bool lodInterpolationEnabled;
     /**
      * 获取骨架数据。
      * @see dragonBones.ArmatureData
@@ -51,10 +70,23 @@ public:
     void* userData;
 
 public:
+    /**
+     * @private
+     */
+    bool _evaluatePose;
     /**
      * @private
      */
     int _cacheFrameIndex;
+    /**
+     * @private
+     */
+    AnimationData* _cacheAnimationData;
+    /**
+     * 不读写动画数据的帧缓存。 (用于在其他线程烘焙帧缓存)
+     * @private
+     */
+    bool _cacheDisabled;
     /**
     * @private
     */
@@ -78,6 +110,16 @@ private:
     bool _flipY;
     std::vector<Bone*> _bones;
     std::vector<Slot*> _slots;
+    bool _lodInterpolated;
+    ArmatureUpdateMode _updateMode;
+    unsigned _lodLevel;
+    unsigned _lodTick;
+    unsigned _updatedBoneCount;
+    unsigned _updatedSlotCount;
+    std::vector<Bone*> _bonesByNameId;
+    std::vector<Slot*> _slotsByNameId;
+    PoseBuffer _poseBuffer;
+    std::vector<Matrix> _lodPoses;
     Animation* _animation;
     void* _display;
     WorldClock* _clock;
@@ -104,6 +146,10 @@ protected:
 private:
     void _sortBones();
     void _sortSlots();
+    void _updatePoseBuffer();
+    int _getNameId(const std::string& name) const;
+    void _restorePose();
+    void _updatePose();
 
 public:
     /**
@@ -128,6 +174,18 @@ public:
     */
     void _removeSlotFromSlotList(Slot* value);
     /**
+    * @private
+    */
+    bool _isPoseRecording() const;
+    /**
+    * @private
+    */
+    void _recordPose();
+    /**
+    * @private
+    */
+    void _interpolatePose(float progress);
+    /**
     * 释放骨架。 (回收到对象池)
     * @version DragonBones 3.0
     * @language zh_CN
@@ -193,6 +251,19 @@ public:
     */
     Bone* getBone(const std::string& name) const;
     /**
+    * 通过名称标识获取骨骼。
+    * @param nameId 骨骼名称在龙骨数据中的标识。
+    * @returns 骨骼。
+    * @see dragonBones.DragonBonesData#getNameId()
+    * @see dragonBones.BoneData#nameId
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline Bone* getBoneByNameId(unsigned nameId) const
+    {
+        return nameId < _bonesByNameId.size() ? _bonesByNameId[nameId] : nullptr;
+    }
+    /**
     * 通过显示对象获取骨骼。
     * @param display 显示对象。
     * @returns 包含这个显示对象的骨骼。
@@ -211,6 +282,19 @@ public:
     */
     Slot* getSlot(const std::string& name) const;
     /**
+    * 通过名称标识获取插槽。
+    * @param nameId 插槽名称在龙骨数据中的标识。
+    * @returns 插槽。
+    * @see dragonBones.DragonBonesData#getNameId()
+    * @see dragonBones.SlotData#nameId
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline Slot* getSlotByNameId(unsigned nameId) const
+    {
+        return nameId < _slotsByNameId.size() ? _slotsByNameId[nameId] : nullptr;
+    }
+    /**
     * 通过显示对象获取插槽。
     * @param display 显示对象。
     * @returns 包含这个显示对象的插槽。
@@ -255,6 +339,60 @@ public:
     {
         return _slots;
     }
+    /**
+    * 上一次更新时实际更新的骨骼数量。
+    * 没有被时间轴、约束或 invalidUpdate() 改变，且所有父级都没有改变的骨骼不会被更新。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline unsigned getUpdatedBoneCount() const
+    {
+        return _updatedBoneCount;
+    }
+    /**
+    * 上一次更新时实际更新的插槽数量。
+    * 自身状态没有改变，且父骨骼没有改变的插槽不会被更新。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline unsigned getUpdatedSlotCount() const
+    {
+        return _updatedSlotCount;
+    }
+    /**
+    * LOD 等级，等级为 N 时每 2^N 次更新只计算一次姿势，其余的更新只推进动画时间和派发帧事件。
+    * @default 0
+    * @see #lodInterpolationEnabled
+    * @see #setLODScreenSize()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline unsigned getLODLevel() const
+    {
+        return _lodLevel;
+    }
+    void setLODLevel(unsigned value);
+    /**
+    * 通过骨架在屏幕上的尺寸设置 LOD 等级，由渲染层在每帧提供。
+    * @param value 骨架的尺寸与屏幕尺寸的比值。
+    * @see #LOD_SCREEN_SIZES
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    void setLODScreenSize(float value);
+    /**
+    * 更新模式。
+    * 设置为 ArmatureUpdateMode::TimeOnly 时只推进动画时间、播放次数和派发事件，不更新骨骼、插槽和网格，通常用于不可见的骨架。
+    * 恢复为 ArmatureUpdateMode::Full 时，下一次更新将完整计算一次姿势。
+    * @default ArmatureUpdateMode::Full
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline ArmatureUpdateMode getUpdateMode() const
+    {
+        return _updateMode;
+    }
+    void setUpdateMode(ArmatureUpdateMode value);
 
     bool getFlipX() const 
     { 
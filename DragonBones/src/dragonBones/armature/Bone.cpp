@@ -1,7 +1,9 @@
 #include "Bone.h"
 #include "../geom/Matrix.h"
 #include "../geom/Transform.h"
+#include "../model/AnimationData.h"
 #include "Armature.h"
+#include "PoseBuffer.h"
 #include "Slot.h"
 #include "Constraint.h"
 
@@ -27,21 +29,18 @@ void Bone::_onClear()
     _localDirty = true;
     _visible = true;
     _cachedFrameIndex = -1;
+    _cachedFrameGeneration = 0;
     _blendLayer = 0;
     _blendLeftWeight = 1.0f;
     _blendLayerWeight = 0.0f;
     _bones.clear();
     _slots.clear();
     _cachedFrameIndices = nullptr;
+    _poseIndex = -1;
 }
 
-void Bone::_updateGlobalTransformMatrix(bool isCache)
+void Bone::_updateLocalTransform()
 {
-    const auto flipX = _armature->getFlipX();
-    const auto flipY = _armature->getFlipY() == DragonBones::yDown;
-    auto inherit = _parent != nullptr;
-    auto dR = 0.0f;
-
     if (offsetMode == OffsetMode::Additive) 
     {
         // global.copyFrom(origin).add(offset).add(animationPose);
@@ -52,11 +51,24 @@ void Bone::_updateGlobalTransformMatrix(bool isCache)
         global.scaleX = origin->scaleX * offset.scaleX * animationPose.scaleX;
         global.scaleY = origin->scaleY * offset.scaleY * animationPose.scaleY;
     }
-    else if (offsetMode == OffsetMode::None) 
+    else 
     {
         global = *origin;
         global.add(animationPose);
     }
+}
+
+void Bone::_updateGlobalTransformMatrix(bool isCache)
+{
+    const auto flipX = _armature->getFlipX();
+    const auto flipY = _armature->getFlipY() == DragonBones::yDown;
+    auto inherit = _parent != nullptr;
+    auto dR = 0.0f;
+
+    if (offsetMode != OffsetMode::Override) 
+    {
+        _updateLocalTransform();
+    }
     else 
     {
         inherit = false;
@@ -251,6 +263,51 @@ void Bone::_setArmature(Armature* value)
     }
 }
 
+void Bone::_updatePose(PoseBuffer& pose)
+{
+    _blendDirty = false;
+
+    auto& dirtyFlag = pose.dirtyFlags[_poseIndex];
+    if (_transformDirty || (_parent != nullptr && _parent->_childrenTransformDirty)) // Dirty.
+    {
+        _transformDirty = false;
+        _childrenTransformDirty = true;
+        _cachedFrameIndex = -1;
+
+        if (_parent == nullptr || offsetMode == OffsetMode::Override) // Not inherit, update by self.
+        {
+            _updateGlobalTransformMatrix(false);
+            pose.setWorld(_poseIndex, globalTransformMatrix);
+            dirtyFlag = PoseBuffer::WORLD_DIRTY;
+        }
+        else 
+        {
+            _updateLocalTransform();
+            pose.setLocal(_poseIndex, global);
+            dirtyFlag = PoseBuffer::LOCAL_DIRTY;
+        }
+    }
+    else 
+    {
+        _childrenTransformDirty = false;
+        pose.setWorld(_poseIndex, globalTransformMatrix); // Children may be dirty.
+        dirtyFlag = PoseBuffer::CLEAN;
+    }
+
+    _localDirty = true;
+}
+
+void Bone::_applyPose(const PoseBuffer& pose)
+{
+    if (pose.dirtyFlags[_poseIndex] == PoseBuffer::LOCAL_DIRTY) 
+    {
+        pose.getWorld(_poseIndex, globalTransformMatrix);
+        global.x = globalTransformMatrix.tx;
+        global.y = globalTransformMatrix.ty;
+        _globalDirty = true;
+    }
+}
+
 void Bone::init(BoneData* pboneData)
 {
     if (boneData != nullptr) 
@@ -269,10 +326,18 @@ void Bone::update(int cacheFrameIndex)
 
     if (cacheFrameIndex >= 0 && _cachedFrameIndices != nullptr) 
     {
+        const auto cacheFrameGeneration = _armature->_cacheAnimationData->cacheFrameGeneration;
+        if (_cachedFrameGeneration != cacheFrameGeneration) // Another animation or replaced records, the offset is invalid.
+        {
+            _cachedFrameGeneration = cacheFrameGeneration;
+            _cachedFrameIndex = -1;
+        }
+
         const auto cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex];
         if (cachedFrameIndex >= 0 && _cachedFrameIndex == cachedFrameIndex) // Same cache.
         {
             _transformDirty = false;
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, boneCacheCount, 1);
         }
         else if (cachedFrameIndex >= 0) // Has been Cached.
         {
@@ -335,16 +400,21 @@ void Bone::update(int cacheFrameIndex)
             if (_localDirty) 
             {
                 _updateGlobalTransformMatrix(isCache);
+                DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, boneUpdateCount, 1);
             }
 
             if (isCache && _cachedFrameIndices != nullptr) 
             {
-                _cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex] = _armature->armatureData->setCacheFrame(globalTransformMatrix, global);
+                const auto animationData = _armature->_cacheAnimationData;
+                _cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex] = animationData->setCacheFrame(
+                    globalTransformMatrix, global, animationData->getBoneCacheFrameOffset(cacheFrameIndex, boneData->index)
+                );
             }
         }
         else 
         {
-            _armature->armatureData->getCacheFrame(globalTransformMatrix, global, _cachedFrameIndex);
+            _armature->_cacheAnimationData->getCacheFrame(globalTransformMatrix, global, _cachedFrameIndex);
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, boneCacheCount, 1);
         }
     }
     else if (_childrenTransformDirty) 
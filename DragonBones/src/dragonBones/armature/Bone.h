@@ -62,13 +62,19 @@ public:
     * @private
     */
     std::vector<int>* _cachedFrameIndices;
+    /**
+    * @private
+    */
+    int _poseIndex;
 
 private:
     bool _localDirty;
     bool _visible;
     int _cachedFrameIndex;
+    unsigned _cachedFrameGeneration;
     mutable std::vector<Bone*> _bones;
     mutable std::vector<Slot*> _slots;
+    void _updateLocalTransform();
     void _updateGlobalTransformMatrix(bool isCache);
 
 protected:
@@ -79,6 +85,23 @@ public:
     * @private
     */
     virtual void _setArmature(Armature* value) override;
+    /**
+    * @private
+    */
+    void _updatePose(PoseBuffer& pose);
+    /**
+    * @private
+    */
+    void _applyPose(const PoseBuffer& pose);
+    /**
+    * @private
+    */
+    inline bool _isClean() const
+    {
+        return
+            !_transformDirty && !_childrenTransformDirty && !_blendDirty && constraints.empty() &&
+            (_parent == nullptr || !_parent->_childrenTransformDirty);
+    }
 
 public:
     /**
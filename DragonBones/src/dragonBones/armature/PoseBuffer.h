@@ -0,0 +1,217 @@
+#ifndef DRAGONBONES_POSE_BUFFER_H
+#define DRAGONBONES_POSE_BUFFER_H
+
+#include "../core/DragonBones.h"
+#include "../geom/Matrix.h"
+#include "../geom/Transform.h"
+#include "../geom/MatrixBatch.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * @private
+ * 骨架的骨骼姿势缓冲区，按骨骼排序顺序连续存储每个骨骼的父级索引、局部变换和全局矩阵。 (结构数组)
+ * 骨骼是缓冲区的视图，更新时在缓冲区中线性计算全局矩阵，然后写回骨骼的 globalTransformMatrix。
+ */
+class PoseBuffer final
+{
+public:
+    enum DirtyFlag
+    {
+        /**
+         * 骨骼不需要更新。
+         */
+        CLEAN = 0,
+        /**
+         * 已写入局部变换，需要计算全局矩阵。
+         */
+        LOCAL_DIRTY = 1,
+        /**
+         * 已写入全局矩阵。 (根骨骼，或由骨骼自身计算)
+         */
+        WORLD_DIRTY = 2
+    };
+
+public:
+    /**
+     * 是否可以使用批量更新。 (所有骨骼都没有约束，且继承父级的位移、旋转和缩放)
+     */
+    bool batched;
+    std::vector<Bone*> bones;
+    std::vector<int> parentIndices;
+    std::vector<uint8_t> dirtyFlags;
+    /**
+     * 局部变换，每个分量一个数组。
+     */
+    float* x;
+    float* y;
+    float* skew;
+    float* rotation;
+    float* scaleX;
+    float* scaleY;
+    /**
+     * 局部矩阵，每个矩阵按 a, b, c, d 连续存储。 (位移即局部变换的 x, y)
+     */
+    float* localMatrices;
+    /**
+     * 全局矩阵，每个矩阵按 a, b, c, d 连续存储，位移单独存储。
+     */
+    float* worldMatrices;
+    float* tx;
+    float* ty;
+
+private:
+    std::size_t _capacity;
+    std::vector<float> _floats;
+
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(PoseBuffer)
+
+public:
+    PoseBuffer() :
+        batched(false),
+        bones(),
+        parentIndices(),
+        dirtyFlags(),
+        _capacity(0),
+        _floats()
+    {
+        _updatePointers();
+    }
+    ~PoseBuffer() {}
+
+private:
+    inline void _updatePointers()
+    {
+        const auto data = _floats.empty() ? nullptr : _floats.data();
+        const auto capacity = _capacity;
+
+        x = data;
+        y = x + capacity;
+        skew = y + capacity;
+        rotation = skew + capacity;
+        scaleX = rotation + capacity;
+        scaleY = scaleX + capacity;
+        localMatrices = scaleY + capacity;
+        worldMatrices = localMatrices + capacity * 4;
+        tx = worldMatrices + capacity * 4;
+        ty = tx + capacity;
+    }
+
+public:
+    /**
+     * 设置骨骼数量，容量按 4 对齐以便批量计算。
+     */
+    inline void resize(std::size_t count)
+    {
+        bones.resize(count, nullptr);
+        parentIndices.resize(count, -1);
+        dirtyFlags.resize(count, CLEAN);
+
+        const auto capacity = (count + 3) & ~(std::size_t)3;
+        if (capacity != _capacity)
+        {
+            _capacity = capacity;
+            _floats.assign(_capacity * 16, 0.0f);
+            _updatePointers();
+        }
+    }
+    inline void clear()
+    {
+        batched = false;
+        bones.clear();
+        parentIndices.clear();
+        dirtyFlags.clear();
+        _capacity = 0;
+        _floats.clear();
+        _updatePointers();
+    }
+    inline std::size_t getCount() const
+    {
+        return bones.size();
+    }
+    inline void setLocal(std::size_t index, const Transform& value)
+    {
+        x[index] = value.x;
+        y[index] = value.y;
+        skew[index] = value.skew;
+        rotation[index] = value.rotation;
+        scaleX[index] = value.scaleX;
+        scaleY[index] = value.scaleY;
+    }
+    inline void setWorld(std::size_t index, const Matrix& value)
+    {
+        const auto matrix = worldMatrices + index * 4;
+        matrix[0] = value.a;
+        matrix[1] = value.b;
+        matrix[2] = value.c;
+        matrix[3] = value.d;
+        tx[index] = value.tx;
+        ty[index] = value.ty;
+    }
+    inline void getWorld(std::size_t index, Matrix& result) const
+    {
+        const auto matrix = worldMatrices + index * 4;
+        result.a = matrix[0];
+        result.b = matrix[1];
+        result.c = matrix[2];
+        result.d = matrix[3];
+        result.tx = tx[index];
+        result.ty = ty[index];
+    }
+    /**
+     * 计算所有需要更新的骨骼的全局矩阵。
+     * 先将局部变换转换为矩阵，再按排序顺序与父级的全局矩阵相乘，父级总是在子级之前完成计算。
+     */
+    void updateWorldMatrices()
+    {
+        const auto count = bones.size();
+
+        for (std::size_t i = 0; i < count; ++i) // Trigonometrics, the scalar part of Transform::toMatrix().
+        {
+            const auto trigonometrics = localMatrices + i * 4;
+            const auto r = rotation[i];
+            const auto s = skew[i];
+            if (dirtyFlags[i] == LOCAL_DIRTY && (s != 0.0f || r != 0.0f))
+            {
+                Trigonometry::sinCos(r, trigonometrics[1], trigonometrics[0]);
+
+                if (s == 0.0f)
+                {
+                    trigonometrics[2] = -trigonometrics[1];
+                    trigonometrics[3] = trigonometrics[0];
+                }
+                else
+                {
+                    Trigonometry::sinCos(s + r, trigonometrics[2], trigonometrics[3]);
+                    trigonometrics[2] = -trigonometrics[2];
+                }
+            }
+            else
+            {
+                trigonometrics[0] = 1.0f;
+                trigonometrics[1] = 0.0f;
+                trigonometrics[2] = 0.0f;
+                trigonometrics[3] = 1.0f;
+            }
+        }
+
+        MatrixBatch::toMatrices(count, localMatrices, scaleX, scaleY, localMatrices);
+
+        for (std::size_t i = 0; i < count; ++i) // Parents are always before children.
+        {
+            if (dirtyFlags[i] != LOCAL_DIRTY)
+            {
+                continue;
+            }
+
+            const auto parentIndex = parentIndices[i];
+            MatrixBatch::concat(
+                localMatrices + i * 4, x[i], y[i],
+                worldMatrices + parentIndex * 4, tx[parentIndex], ty[parentIndex],
+                worldMatrices + i * 4, tx[i], ty[i]
+            );
+        }
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_POSE_BUFFER_H
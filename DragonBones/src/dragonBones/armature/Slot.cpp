@@ -3,6 +3,7 @@
 #include "../model/DragonBonesData.h"
 #include "../model/UserData.h"
 #include "../model/ArmatureData.h"
+#include "../model/AnimationData.h"
 #include "../model/DisplayData.h"
 #include "../model/BoundingBoxData.h"
 #include "../model/TextureAtlasData.h"
@@ -64,6 +65,7 @@ void Slot::_onClear()
     _animationDisplayIndex = -1;
     _zOrder = 0;
     _cachedFrameIndex = -1;
+    _cachedFrameGeneration = 0;
     _pivotX = 0.0f;
     _pivotY = 0.0f;
     _localMatrix.identity();
@@ -229,17 +231,21 @@ void Slot::_updateDisplayData()
 
         if (_displayData != nullptr && rawDisplayData != nullptr && _displayData != rawDisplayData && _meshData == nullptr)
         {
-            rawDisplayData->transform.toMatrix(_helpMatrix);
-            _helpMatrix.invert();
-            _helpMatrix.transformPoint(0.0f, 0.0f, _helpPoint);
-            _pivotX -= _helpPoint.x;
-            _pivotY -= _helpPoint.y;
+            // Local helpers, slots may be built on a loader thread.
+            Matrix helpMatrix;
+            Point helpPoint;
 
-            _displayData->transform.toMatrix(_helpMatrix);
-            _helpMatrix.invert();
-            _helpMatrix.transformPoint(0.0f, 0.0f, _helpPoint);
-            _pivotX += _helpPoint.x;
-            _pivotY += _helpPoint.y;
+            rawDisplayData->transform.toMatrix(helpMatrix);
+            helpMatrix.invert();
+            helpMatrix.transformPoint(0.0f, 0.0f, helpPoint);
+            _pivotX -= helpPoint.x;
+            _pivotY -= helpPoint.y;
+
+            _displayData->transform.toMatrix(helpMatrix);
+            helpMatrix.invert();
+            helpMatrix.transformPoint(0.0f, 0.0f, helpPoint);
+            _pivotX += helpPoint.x;
+            _pivotY += helpPoint.y;
         }
 
         // Update original transform.
@@ -559,6 +565,13 @@ void Slot::update(int cacheFrameIndex)
 
     if (cacheFrameIndex >= 0 && _cachedFrameIndices != nullptr)
     {
+        const auto cacheFrameGeneration = _armature->_cacheAnimationData->cacheFrameGeneration;
+        if (_cachedFrameGeneration != cacheFrameGeneration) // Another animation or replaced records, the offset is invalid.
+        {
+            _cachedFrameGeneration = cacheFrameGeneration;
+            _cachedFrameIndex = -1;
+        }
+
         const auto cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex];
         if (cachedFrameIndex >= 0 && _cachedFrameIndex == cachedFrameIndex) // Same cache.
         {
@@ -616,6 +629,7 @@ void Slot::update(int cacheFrameIndex)
         {
             _meshDirty = false;
             _updateMesh();
+            DRAGONBONES_PROFILE_COUNT(_armature->_dragonBones, meshUpdateCount, 1);
         }
 
         if (isSkinned) 
@@ -641,18 +655,28 @@ void Slot::update(int cacheFrameIndex)
 
             if (isCache && _cachedFrameIndices != nullptr)
             {
-                _cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex] = _armature->armatureData->setCacheFrame(globalTransformMatrix, global);
+                const auto animationData = _armature->_cacheAnimationData;
+                _cachedFrameIndex = (*_cachedFrameIndices)[cacheFrameIndex] = animationData->setCacheFrame(
+                    globalTransformMatrix, global, animationData->getSlotCacheFrameOffset(cacheFrameIndex, slotData->index)
+                );
             }
         }
         else
         {
-            _armature->armatureData->getCacheFrame(globalTransformMatrix, global, _cachedFrameIndex);
+            _armature->_cacheAnimationData->getCacheFrame(globalTransformMatrix, global, _cachedFrameIndex);
         }
 
         _updateTransform(false);
     }
 }
 
+bool Slot::_isClean() const
+{
+    return
+        !_displayDirty && !_zOrderDirty && !_blendModeDirty && !_colorDirty && !_meshDirty && !_transformDirty &&
+        !_parent->_childrenTransformDirty && !_isMeshBonesUpdate();
+}
+
 bool Slot::containsPoint(float x, float y)
 {
     if (_boundingBoxData == nullptr) 
@@ -63,6 +63,7 @@ protected:
     int _displayIndex;
     int _animationDisplayIndex;
     int _cachedFrameIndex;
+    unsigned _cachedFrameGeneration;
     Matrix _localMatrix;
     std::vector<std::pair<void*, DisplayType>> _displayList;
     std::vector<Bone*> _meshBones;
@@ -120,6 +121,10 @@ public:
     /**
     * @private
     */
+    bool _isClean() const;
+    /**
+    * @private
+    */
     inline void updateTransformAndMatrix()
     {
         if (_transformDirty)
@@ -1,23 +1,223 @@
 #include "BaseObject.h"
 DRAGONBONES_NAMESPACE_BEGIN
 
-unsigned BaseObject::_hashCode = 0;
-unsigned BaseObject::_defaultMaxCount = 1000;
-std::map<std::size_t, unsigned> BaseObject::_maxCountMap;
-std::map<std::size_t, std::vector<BaseObject*>> BaseObject::_poolsMap;
+std::atomic<unsigned> BaseObject::_hashCode(0);
+std::mutex BaseObject::_classTypeMutex;
+std::vector<BaseObject::ClassType*> BaseObject::_classTypes(1, nullptr); // Type index 0 is reserved for "all classes".
+std::vector<BaseObject*> BaseObject::_handOffObjects;
+std::vector<BaseObject::PoolContext*> BaseObject::_poolContexts;
+thread_local BaseObject::PoolContext BaseObject::_poolContext;
+
+BaseObject::PoolContext::PoolContext() :
+    defaultMaxCount(1000),
+    arena(nullptr),
+    pools()
+{
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+    _poolContexts.push_back(this);
+}
+
+BaseObject::PoolContext::~PoolContext()
+{
+    // Thread exit, the slabs are shared so the cached objects can be destroyed from any thread.
+    for (auto i = (std::size_t)1, l = pools.size(); i < l; ++i)
+    {
+        _trimPool(i, pools[i], 0);
+    }
+
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+    for (auto i = (std::size_t)1, l = pools.size(); i < l; ++i) // Keep the statistics of the thread.
+    {
+        const auto& pool = pools[i];
+        auto& classType = *_classTypes[i];
+        classType.retiredLiveCount += pool.liveCount.load(std::memory_order_relaxed);
+        classType.retiredBorrowHitCount += pool.borrowHitCount.load(std::memory_order_relaxed);
+        classType.retiredBorrowMissCount += pool.borrowMissCount.load(std::memory_order_relaxed);
+    }
+
+    _poolContexts.erase(std::find(_poolContexts.begin(), _poolContexts.end(), this));
+}
+
+void BaseObject::PoolContext::_addPool(std::size_t classTypeIndex)
+{
+    std::lock_guard<std::mutex> lock(_classTypeMutex); // getPoolStats() reads the pools of every thread.
+    if (classTypeIndex >= pools.size())
+    {
+        pools.resize(classTypeIndex + 1);
+    }
+
+    pools[classTypeIndex].classType = _classTypes[classTypeIndex];
+}
+
+std::size_t BaseObject::_registerClassType(const char* className, std::size_t classSize, std::size_t classAlign, BaseObject* (*creator)(void* memory))
+{
+    auto slotSize = (classSize + classAlign - 1) / classAlign * classAlign;
+    if (slotSize < sizeof(void*))
+    {
+        slotSize = sizeof(void*);
+    }
+
+    auto slabSlotCount = (std::size_t)DRAGONBONES_POOL_SLAB_SIZE / slotSize;
+    if (slabSlotCount < 4)
+    {
+        slabSlotCount = 4;
+    }
+
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+    _classTypes.push_back(new ClassType(className, creator, classSize, slotSize, slabSlotCount)); // Class types live as long as the process.
+
+    return _classTypes.size() - 1;
+}
+
+void BaseObject::_getPoolCounts(std::size_t classTypeIndex, int& liveCount, unsigned& borrowHitCount, unsigned& borrowMissCount)
+{
+    const auto& classType = *_classTypes[classTypeIndex];
+    liveCount = classType.retiredLiveCount;
+    borrowHitCount = classType.retiredBorrowHitCount;
+    borrowMissCount = classType.retiredBorrowMissCount;
+
+    for (const auto poolContext : _poolContexts)
+    {
+        if (classTypeIndex < poolContext->pools.size())
+        {
+            const auto& pool = poolContext->pools[classTypeIndex];
+            liveCount += pool.liveCount.load(std::memory_order_relaxed);
+            borrowHitCount += pool.borrowHitCount.load(std::memory_order_relaxed);
+            borrowMissCount += pool.borrowMissCount.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void* BaseObject::_allocateSlot(ClassType& classType)
+{
+    if (classType.freeSlots == nullptr)
+    {
+        const auto slab = static_cast<char*>(::operator new(classType.slotSize * classType.slabSlotCount, std::nothrow));
+        if (slab == nullptr)
+        {
+            return nullptr;
+        }
+
+        classType.slabs.push_back(slab);
+
+        // Link the slots backward so they are handed out in address order.
+        for (std::size_t i = classType.slabSlotCount; i-- > 0;)
+        {
+            const auto slot = slab + i * classType.slotSize;
+            *reinterpret_cast<void**>(slot) = classType.freeSlots;
+            classType.freeSlots = slot;
+        }
+
+        classType.freeSlotCount += classType.slabSlotCount;
+    }
+
+    const auto slot = classType.freeSlots;
+    classType.freeSlots = *static_cast<void**>(slot);
+    classType.freeSlotCount--;
+
+    return slot;
+}
+
+void* BaseObject::_allocateObject(std::size_t classTypeIndex)
+{
+    if (_poolContext.arena != nullptr)
+    {
+        return _poolContext.arena->_allocate(_poolContext.getPool(classTypeIndex).classType->slotSize);
+    }
+
+    auto& pool = _poolContext.getPool(classTypeIndex);
+
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+
+    auto& classType = *pool.classType;
+    const auto slot = _allocateSlot(classType);
+    if (slot != nullptr)
+    {
+        ObjectPool::addCount(pool.liveCount, 1);
+        ObjectPool::addCount(pool.borrowMissCount, 1u);
+
+        // Sample the peak on misses, new objects are allocated when the live objects outgrow the pools.
+        int liveCount = 0;
+        unsigned borrowHitCount = 0, borrowMissCount = 0;
+        _getPoolCounts(classTypeIndex, liveCount, borrowHitCount, borrowMissCount);
+        if (liveCount > (int)classType.peakLiveCount)
+        {
+            classType.peakLiveCount = (unsigned)liveCount;
+        }
+    }
+
+    return slot;
+}
+
+void BaseObject::_destroyObject(BaseObject* object)
+{
+    const auto classTypeIndex = object->getClassTypeIndex();
+    const auto slot = dynamic_cast<void*>(object); // The most derived object is the start of the slot.
+    object->~BaseObject(); // Destructors may return other objects, do not hold the lock here.
+
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+    auto& classType = *_classTypes[classTypeIndex];
+    *static_cast<void**>(slot) = classType.freeSlots;
+    classType.freeSlots = slot;
+    classType.freeSlotCount++;
+}
+
+void BaseObject::_releaseSlabs(std::size_t classTypeIndex)
+{
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+
+    // Release slabs only when all of their slots are free, live objects keep the memory.
+    auto& classType = *_classTypes[classTypeIndex];
+    if (!classType.slabs.empty() && classType.freeSlotCount == classType.slabs.size() * classType.slabSlotCount)
+    {
+        for (const auto slab : classType.slabs)
+        {
+            ::operator delete(slab);
+        }
+
+        classType.slabs.clear();
+        classType.freeSlots = nullptr;
+        classType.freeSlotCount = 0;
+    }
+}
+
+void BaseObject::_trimPool(std::size_t classTypeIndex, ObjectPool& pool, std::size_t count)
+{
+    if (pool.objects.size() > count)
+    {
+        for (auto i = count, l = pool.objects.size(); i < l; ++i)
+        {
+            _destroyObject(pool.objects[i]);
+        }
+
+        pool.objects.resize(count);
+    }
+
+    _releaseSlabs(classTypeIndex);
+}
+
+void BaseObject::_addArenaObject(BaseObject* object)
+{
+    object->_isArenaObject = true;
+    _poolContext.arena->_objects.push_back(object);
+}
 
 void BaseObject::_returnObject(BaseObject* object)
 {
-    const auto classType = object->getClassTypeIndex();
-    const auto maxCountIterator = _maxCountMap.find(classType);
-    const auto maxCount = maxCountIterator != _maxCountMap.end() ? maxCountIterator->second : _defaultMaxCount;
-    auto& pool = _poolsMap[classType];
-    if (pool.size() < maxCount)
+    if (object->_isArenaObject) // The arena owns the memory.
+    {
+        return;
+    }
+
+    auto& pool = _poolContext.getPool(object->getClassTypeIndex());
+    const auto maxCount = pool.hasMaxCount ? pool.maxCount : _poolContext.defaultMaxCount;
+    if (pool.objects.size() < maxCount)
     {
         if (!object->_isInPool)
         {
             object->_isInPool = true;
-            pool.push_back(object);
+            pool.objects.push_back(object);
+            ObjectPool::addCount(pool.liveCount, -1);
         }
         else
         {
@@ -26,7 +226,8 @@ void BaseObject::_returnObject(BaseObject* object)
     }
     else
     {
-        delete object;
+        ObjectPool::addCount(pool.liveCount, -1);
+        _destroyObject(object);
     }
 }
 
@@ -34,90 +235,308 @@ void BaseObject::setMaxCount(std::size_t classType, unsigned maxCount)
 {
     if (classType > 0)
     {
-        const auto iterator = _poolsMap.find(classType);
-        if (iterator != _poolsMap.end())
+        auto& pool = _poolContext.getPool(classType);
+        _trimPool(classType, pool, maxCount);
+        pool.hasMaxCount = true;
+        pool.maxCount = maxCount;
+    }
+    else
+    {
+        auto& pools = _poolContext.pools;
+        _poolContext.defaultMaxCount = maxCount;
+        for (auto i = (std::size_t)1, l = pools.size(); i < l; ++i)
         {
-            auto& pool = iterator->second;
-            if (pool.size() > (size_t)maxCount)
+            auto& pool = pools[i];
+            if (!pool.hasMaxCount)
             {
-                for (auto i = (size_t)maxCount, l = pool.size(); i < l; ++i)
-                {
-                    delete pool[i];
-                }
-
-                pool.resize(maxCount);
+                continue;
             }
+
+            _trimPool(i, pool, maxCount);
+            pool.maxCount = maxCount;
         }
+    }
+}
 
-        _maxCountMap[classType] = maxCount;
+void BaseObject::clearPool(std::size_t classType)
+{
+    auto& pools = _poolContext.pools;
+    if (classType > 0)
+    {
+        if (classType < pools.size())
+        {
+            _trimPool(classType, pools[classType], 0);
+        }
     }
     else
     {
-        _defaultMaxCount = maxCount;
-        for (auto& pair : _poolsMap)
+        for (auto i = (std::size_t)1, l = pools.size(); i < l; ++i)
         {
-            if (_maxCountMap.find(pair.first) == _maxCountMap.end())
-            {
-                continue;
-            }
+            _trimPool(i, pools[i], 0);
+        }
+    }
+}
 
-            auto& pool = pair.second;
-            if (pool.size() > (size_t)maxCount)
-            {
-                for (auto i = (size_t)maxCount, l = pool.size(); i < l; ++i)
-                {
-                    delete pool[i];
-                }
+void BaseObject::exportPool()
+{
+    std::vector<BaseObject*> objects;
+    for (auto& pool : _poolContext.pools)
+    {
+        objects.insert(objects.end(), pool.objects.begin(), pool.objects.end());
+        pool.objects.clear();
+    }
 
-                pool.resize(maxCount);
-            }
+    if (!objects.empty())
+    {
+        std::lock_guard<std::mutex> lock(_classTypeMutex);
+        _handOffObjects.insert(_handOffObjects.end(), objects.begin(), objects.end());
+    }
+}
 
-            _maxCountMap[pair.first] = maxCount;
+void BaseObject::importPool()
+{
+    std::vector<BaseObject*> objects;
+    {
+        std::lock_guard<std::mutex> lock(_classTypeMutex);
+        objects.swap(_handOffObjects);
+    }
+
+    for (const auto object : objects)
+    {
+        auto& pool = _poolContext.getPool(object->getClassTypeIndex());
+        const auto maxCount = pool.hasMaxCount ? pool.maxCount : _poolContext.defaultMaxCount;
+        if (pool.objects.size() < maxCount)
+        {
+            pool.objects.push_back(object);
+        }
+        else
+        {
+            _destroyObject(object);
         }
     }
 }
 
-void BaseObject::clearPool(std::size_t classType)
+void BaseObject::prewarm(std::size_t classTypeIndex, unsigned count)
 {
-    if (classType > 0)
+    if (classTypeIndex == 0)
     {
-        const auto iterator = _poolsMap.find(classType);
-        if (iterator != _poolsMap.end())
+        return;
+    }
+
+    auto& pool = _poolContext.getPool(classTypeIndex);
+    const auto maxCount = pool.hasMaxCount ? pool.maxCount : _poolContext.defaultMaxCount;
+    if (count > maxCount) // Keep the prewarmed objects when they are returned.
+    {
+        pool.hasMaxCount = true;
+        pool.maxCount = count;
+    }
+
+    if (pool.objects.size() >= count)
+    {
+        return;
+    }
+
+    const auto classType = pool.classType;
+    std::vector<void*> slots;
+    {
+        std::lock_guard<std::mutex> lock(_classTypeMutex);
+        for (auto i = pool.objects.size(); i < count; ++i)
         {
-            auto& pool = iterator->second;
-            if (!pool.empty())
+            const auto slot = _allocateSlot(*classType);
+            if (slot == nullptr)
             {
-                for (auto object : pool)
-                {
-                    delete object;
-                }
-
-                pool.clear();
+                break;
             }
+
+            slots.push_back(slot);
         }
     }
-    else
+
+    for (const auto slot : slots)
+    {
+        const auto object = classType->creator(slot);
+        object->_isInPool = true;
+        pool.objects.push_back(object);
+    }
+}
+
+ObjectArena* BaseObject::setArena(ObjectArena* value)
+{
+    const auto prevArena = _poolContext.arena;
+    _poolContext.arena = value;
+
+    return prevArena;
+}
+
+void BaseObject::getPoolStats(std::vector<PoolStats>& result)
+{
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+
+    result.clear();
+    result.reserve(_classTypes.size() - 1);
+
+    for (auto i = (std::size_t)1, l = _classTypes.size(); i < l; ++i)
     {
-        for (auto& pair : _poolsMap)
+        auto& classType = *_classTypes[i];
+        int liveCount = 0;
+        unsigned borrowHitCount = 0, borrowMissCount = 0;
+        _getPoolCounts(i, liveCount, borrowHitCount, borrowMissCount);
+        const auto allocatedCount = (int)classType.getAllocatedCount();
+        if (liveCount < 0) // The counters of other threads are read while they are updated.
         {
-            auto& pool = pair.second;
-            if (!pool.empty())
-            {
-                for (auto object : pool)
-                {
-                    delete object;
-                }
+            liveCount = 0;
+        }
+        else if (liveCount > allocatedCount)
+        {
+            liveCount = allocatedCount;
+        }
 
-                pool.clear();
-            }
+        if ((unsigned)liveCount > classType.peakLiveCount)
+        {
+            classType.peakLiveCount = (unsigned)liveCount;
+        }
+
+        result.resize(result.size() + 1);
+        auto& stats = result.back();
+        stats.classTypeIndex = i;
+        stats.className = classType.className;
+        stats.size = classType.size;
+        stats.liveCount = (unsigned)liveCount;
+        stats.pooledCount = (unsigned)(allocatedCount - liveCount); // Pools of all threads and handed off objects.
+        stats.peakLiveCount = classType.peakLiveCount;
+        stats.borrowHitCount = borrowHitCount - classType.resetBorrowHitCount;
+        stats.borrowMissCount = borrowMissCount - classType.resetBorrowMissCount;
+        stats.bytes = classType.size * (stats.liveCount + stats.pooledCount);
+        stats.reservedBytes = classType.slotSize * classType.slabSlotCount * classType.slabs.size();
+    }
+}
+
+std::string BaseObject::dumpPoolStats(bool isJSON)
+{
+    std::vector<PoolStats> poolStats;
+    getPoolStats(poolStats);
+
+    std::ostringstream stream;
+    if (isJSON)
+    {
+        stream << "[";
+        for (std::size_t i = 0, l = poolStats.size(); i < l; ++i)
+        {
+            const auto& stats = poolStats[i];
+            stream << (i > 0 ? "," : "") << "{"
+                << "\"classTypeIndex\":" << stats.classTypeIndex << ","
+                << "\"className\":\"" << stats.className << "\","
+                << "\"size\":" << stats.size << ","
+                << "\"live\":" << stats.liveCount << ","
+                << "\"pooled\":" << stats.pooledCount << ","
+                << "\"peakLive\":" << stats.peakLiveCount << ","
+                << "\"hits\":" << stats.borrowHitCount << ","
+                << "\"misses\":" << stats.borrowMissCount << ","
+                << "\"bytes\":" << stats.bytes << ","
+                << "\"reservedBytes\":" << stats.reservedBytes
+                << "}";
+        }
+        stream << "]";
+    }
+    else
+    {
+        stream << "class size live pooled peakLive hits misses bytes reservedBytes\n";
+        for (const auto& stats : poolStats)
+        {
+            stream << stats.className << " "
+                << stats.size << " "
+                << stats.liveCount << " "
+                << stats.pooledCount << " "
+                << stats.peakLiveCount << " "
+                << stats.borrowHitCount << " "
+                << stats.borrowMissCount << " "
+                << stats.bytes << " "
+                << stats.reservedBytes << "\n";
         }
     }
+
+    return stream.str();
+}
+
+void BaseObject::resetPoolStats()
+{
+    std::lock_guard<std::mutex> lock(_classTypeMutex);
+
+    for (auto i = (std::size_t)1, l = _classTypes.size(); i < l; ++i)
+    {
+        auto& classType = *_classTypes[i];
+        int liveCount = 0;
+        _getPoolCounts(i, liveCount, classType.resetBorrowHitCount, classType.resetBorrowMissCount);
+        classType.peakLiveCount = liveCount > 0 ? (unsigned)liveCount : 0;
+    }
 }
 
 void BaseObject::returnToPool()
 {
+    if (_isArenaObject) // The arena clears and destroys it at once.
+    {
+        return;
+    }
+
     _onClear();
     BaseObject::_returnObject(this);
 }
 
+void* ObjectArena::_allocate(std::size_t size)
+{
+    const auto align = alignof(std::max_align_t);
+    size = (size + align - 1) / align * align;
+
+    if (size > _blockSize) // Large object, dedicated block.
+    {
+        const auto block = static_cast<char*>(::operator new(size, std::nothrow));
+        if (block != nullptr)
+        {
+            // Keep the current block last, small objects are still allocated from its remaining space.
+            _blocks.insert(_blocks.empty() ? _blocks.end() : _blocks.end() - 1, block);
+            _bytes += size;
+        }
+
+        return block;
+    }
+
+    if (_blockOffset + size > _blockSize)
+    {
+        const auto block = static_cast<char*>(::operator new(_blockSize, std::nothrow));
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        _blocks.push_back(block);
+        _blockOffset = 0;
+    }
+
+    const auto memory = _blocks.back() + _blockOffset;
+    _blockOffset += size;
+    _bytes += size;
+
+    return memory;
+}
+
+void ObjectArena::clear()
+{
+    // The destructors clear every object once, returning the children to the arena does nothing.
+    // Owners are created before their children, so the children are still alive while their owners are destroyed.
+    for (const auto object : _objects)
+    {
+        object->~BaseObject();
+    }
+
+    for (const auto block : _blocks)
+    {
+        ::operator delete(block);
+    }
+
+    _blockOffset = _blockSize;
+    _bytes = 0;
+    _blocks.clear();
+    _objects.clear();
+}
+
 DRAGONBONES_NAMESPACE_END
@@ -3,24 +3,207 @@
 
 #include "DragonBones.h"
 
+// Slab size of the object pools, objects of the same class are allocated contiguously in slabs.
+#ifndef DRAGONBONES_POOL_SLAB_SIZE
+#define DRAGONBONES_POOL_SLAB_SIZE 8192
+#endif
+
+// Block size of the object arenas.
+#ifndef DRAGONBONES_ARENA_BLOCK_SIZE
+#define DRAGONBONES_ARENA_BLOCK_SIZE 65536
+#endif
+
 DRAGONBONES_NAMESPACE_BEGIN
 /**
  * 基础对象。
+ * 对象池按线程独立，每个线程从自己的对象池中创建和回收对象，因此可以在加载线程中解析数据和创建骨架。
+ * 对象可以在线程之间移交，由哪个线程返还，就进入哪个线程的对象池。
  * @version DragonBones 4.5
  * @language zh_CN
  */
 class BaseObject
 {
+    friend class ObjectArena;
+
+public:
+    /**
+     * 对象池的统计信息。
+     * @see #getPoolStats()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    struct PoolStats
+    {
+        /**
+         * 对象类的类型索引。
+         */
+        std::size_t classTypeIndex;
+        /**
+         * 对象类的名称。
+         */
+        std::string className;
+        /**
+         * 对象类的大小。 (sizeof)
+         */
+        std::size_t size;
+        /**
+         * 正在使用的对象数量。
+         */
+        unsigned liveCount;
+        /**
+         * 缓存在对象池中的对象数量。 (所有线程)
+         */
+        unsigned pooledCount;
+        /**
+         * 正在使用的对象数量的峰值。 (在分配新对象和获取统计信息时采样)
+         */
+        unsigned peakLiveCount;
+        /**
+         * 从对象池中取得对象的次数。
+         */
+        unsigned borrowHitCount;
+        /**
+         * 对象池为空，需要分配新对象的次数。
+         */
+        unsigned borrowMissCount;
+        /**
+         * 正在使用和缓存的对象所占的字节数。
+         */
+        std::size_t bytes;
+        /**
+         * 为该类分配的内存块的总字节数。
+         */
+        std::size_t reservedBytes;
+    };
+
 private:
-    static unsigned _hashCode;
-    static unsigned _defaultMaxCount;
-    static std::map<std::size_t, unsigned> _maxCountMap;
-    static std::map<std::size_t, std::vector<BaseObject*>> _poolsMap;
+    /**
+     * @private
+     */
+    struct ClassType
+    {
+        const char* className;
+        BaseObject* (*creator)(void* memory);
+        std::size_t size;
+        std::size_t slotSize;
+        std::size_t slabSlotCount;
+        std::size_t freeSlotCount;
+        void* freeSlots;
+        std::vector<void*> slabs;
+        // Statistics are counted per thread, these are guarded by the class type mutex.
+        int retiredLiveCount;
+        unsigned retiredBorrowHitCount;
+        unsigned retiredBorrowMissCount;
+        unsigned resetBorrowHitCount;
+        unsigned resetBorrowMissCount;
+        unsigned peakLiveCount;
+
+        ClassType(const char* className, BaseObject* (*creator)(void* memory), std::size_t size, std::size_t slotSize, std::size_t slabSlotCount) :
+            className(className),
+            creator(creator),
+            size(size),
+            slotSize(slotSize),
+            slabSlotCount(slabSlotCount),
+            freeSlotCount(0),
+            freeSlots(nullptr),
+            slabs(),
+            retiredLiveCount(0),
+            retiredBorrowHitCount(0),
+            retiredBorrowMissCount(0),
+            resetBorrowHitCount(0),
+            resetBorrowMissCount(0),
+            peakLiveCount(0)
+        {}
+
+        inline std::size_t getAllocatedCount() const
+        {
+            return slabs.size() * slabSlotCount - freeSlotCount;
+        }
+    };
+    /**
+     * @private
+     */
+    struct ObjectPool
+    {
+        bool hasMaxCount;
+        unsigned maxCount;
+        ClassType* classType;
+        std::vector<BaseObject*> objects;
+        // Written by the owner thread only, read by getPoolStats() from any thread.
+        std::atomic<int> liveCount;
+        std::atomic<unsigned> borrowHitCount;
+        std::atomic<unsigned> borrowMissCount;
+
+        ObjectPool() :
+            hasMaxCount(false),
+            maxCount(0),
+            classType(nullptr),
+            objects(),
+            liveCount(0),
+            borrowHitCount(0),
+            borrowMissCount(0)
+        {}
+        ObjectPool(ObjectPool&& value) noexcept :
+            hasMaxCount(value.hasMaxCount),
+            maxCount(value.maxCount),
+            classType(value.classType),
+            objects(std::move(value.objects)),
+            liveCount(value.liveCount.load(std::memory_order_relaxed)),
+            borrowHitCount(value.borrowHitCount.load(std::memory_order_relaxed)),
+            borrowMissCount(value.borrowMissCount.load(std::memory_order_relaxed))
+        {}
+
+        template<typename T>
+        inline static void addCount(std::atomic<T>& count, T value)
+        {
+            count.store(count.load(std::memory_order_relaxed) + value, std::memory_order_relaxed); // Single writer, no read-modify-write.
+        }
+    };
+    /**
+     * @private
+     */
+    class PoolContext
+    {
+    public:
+        unsigned defaultMaxCount;
+        ObjectArena* arena;
+        std::vector<ObjectPool> pools;
+
+        PoolContext();
+        ~PoolContext();
+
+        inline ObjectPool& getPool(std::size_t classTypeIndex)
+        {
+            if (classTypeIndex >= pools.size() || pools[classTypeIndex].classType == nullptr)
+            {
+                _addPool(classTypeIndex);
+            }
+
+            return pools[classTypeIndex];
+        }
+
+    private:
+        void _addPool(std::size_t classTypeIndex);
+    };
+
+    static std::atomic<unsigned> _hashCode;
+    static std::mutex _classTypeMutex;
+    static std::vector<ClassType*> _classTypes;
+    static std::vector<BaseObject*> _handOffObjects;
+    static std::vector<PoolContext*> _poolContexts;
+    static thread_local PoolContext _poolContext;
+    static void _getPoolCounts(std::size_t classTypeIndex, int& liveCount, unsigned& borrowHitCount, unsigned& borrowMissCount);
+    static void* _allocateSlot(ClassType& classType);
+    static void* _allocateObject(std::size_t classTypeIndex);
+    static void _destroyObject(BaseObject* object);
+    static void _releaseSlabs(std::size_t classTypeIndex);
+    static void _trimPool(std::size_t classTypeIndex, ObjectPool& pool, std::size_t count);
+    static void _addArenaObject(BaseObject* object);
     static void _returnObject(BaseObject *object);
 
 public:
     /**
-     * 设置每种对象池的最大缓存数量。
+     * 设置当前线程每种对象池的最大缓存数量。
      * @param objectConstructor 对象类。
      * @param maxCount 最大缓存数量。 (设置为 0 则不缓存)
      * @version DragonBones 4.5
@@ -28,36 +211,106 @@ public:
      */
     static void setMaxCount(std::size_t classTypeIndex, unsigned maxCount);
     /**
-     * 清除对象池缓存的对象。
+     * 清除当前线程对象池缓存的对象。
      * @param objectConstructor 对象类。 (不设置则清除所有缓存)
      * @version DragonBones 4.5
      * @language zh_CN
      */
     static void clearPool(std::size_t classTypeIndex = 0);
     /**
-     * 从对象池中创建指定对象。
+     * 将当前线程对象池缓存的所有对象移交出去，由其他线程通过 importPool() 接收。
+     * 通常在加载线程完成工作后调用，使其缓存的对象可以被渲染线程复用。
+     * @see #importPool()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void exportPool();
+    /**
+     * 接收其他线程通过 exportPool() 移交的对象，放入当前线程的对象池。 (超出最大缓存数量的对象将被销毁)
+     * @see #exportPool()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void importPool();
+    /**
+     * 预先创建指定类型的对象并放入当前线程的对象池，以免运行时分配内存。 (数量超过最大缓存数量时，将该类型的最大缓存数量提高到该数量)
+     * @param classTypeIndex 对象类。
+     * @param count 对象池中至少缓存的对象数量。
+     * @see dragonBones.BaseFactory#prewarm()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void prewarm(std::size_t classTypeIndex, unsigned count);
+    /**
+     * 设置当前线程创建对象时使用的内存区，设置后 borrowObject() 将在内存区中创建对象而不使用对象池。
+     * @param value 内存区。 (设置为 nullptr 则恢复使用对象池)
+     * @returns 之前设置的内存区。
+     * @see dragonBones.ObjectArena
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static ObjectArena* setArena(ObjectArena* value);
+    /**
+     * 获取每种对象池的统计信息。
+     * @param result 统计信息，按类型索引排序。
+     * @see dragonBones.BaseObject.PoolStats
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void getPoolStats(std::vector<PoolStats>& result);
+    /**
+     * 将对象池的统计信息输出为文本或 JSON。
+     * @param isJSON 是否输出为 JSON。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static std::string dumpPoolStats(bool isJSON = false);
+    /**
+     * 重置对象池的取得次数、分配次数和峰值。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void resetPoolStats();
+    /**
+     * 从当前线程的对象池中创建指定对象。
      * @param objectConstructor 对象类。
      * @version DragonBones 4.5
      * @language zh_CN
      */
     template<typename T>
-    static T* borrowObject() 
+    static T* borrowObject()
     {
         const auto classTypeIndex = T::getTypeIndex();
-        const auto iterator = _poolsMap.find(classTypeIndex);
-        if (iterator != _poolsMap.end())
+        auto& poolContext = _poolContext;
+        auto& pools = poolContext.pools;
+        if (poolContext.arena == nullptr && classTypeIndex < pools.size())
         {
-            auto& pool = iterator->second;
-            if (!pool.empty())
+            auto& pool = pools[classTypeIndex];
+            if (!pool.objects.empty())
             {
-                const auto object = static_cast<T*>(pool.back());
-                pool.pop_back();
+                const auto object = static_cast<T*>(pool.objects.back());
+                pool.objects.pop_back();
                 object->_isInPool = false;
+
+                ObjectPool::addCount(pool.liveCount, 1);
+                ObjectPool::addCount(pool.borrowHitCount, 1u);
+
                 return object;
             }
         }
 
-        const auto object = new (std::nothrow) T();
+        const auto memory = _allocateObject(classTypeIndex);
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto object = new (memory) T();
+        if (poolContext.arena != nullptr)
+        {
+            _addArenaObject(object);
+        }
+
         return object;
     }
 
@@ -73,21 +326,27 @@ public:
 
 private:
     bool _isInPool;
+    bool _isArenaObject;
 
 protected:
     BaseObject() :
         hashCode(BaseObject::_hashCode++),
-        _isInPool(false)
+        _isInPool(false),
+        _isArenaObject(false)
     {}
     virtual void _onClear() = 0;
 
 public:
+    /**
+     * @private
+     */
+    static std::size_t _registerClassType(const char* className, std::size_t classSize, std::size_t classAlign, BaseObject* (*creator)(void* memory));
     /**
      * @private
      */
     virtual std::size_t getClassTypeIndex() const = 0;
     /**
-     * 清除数据并返还对象池。
+     * 清除数据并返还当前线程的对象池。
      * @version DragonBones 4.5
      * @language zh_CN
      */
@@ -96,6 +355,77 @@ public:
 public: // For WebAssembly.
     int getHashCode() const { return hashCode; }
 };
+/**
+ * 对象内存区。
+ * 在内存区中创建的对象按块连续分配，返还时不清除数据也不进入对象池，内存区销毁时统一清除并销毁对象，然后释放内存块。
+ * @see dragonBones.BaseObject#setArena()
+ * @version DragonBones 5.1
+ * @language zh_CN
+ */
+class ObjectArena
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(ObjectArena)
+
+    friend class BaseObject;
+
+private:
+    std::size_t _blockSize;
+    std::size_t _blockOffset;
+    std::size_t _bytes;
+    std::vector<char*> _blocks;
+    std::vector<BaseObject*> _objects;
+
+public:
+    ObjectArena(std::size_t blockSize = DRAGONBONES_ARENA_BLOCK_SIZE) :
+        _blockSize(blockSize),
+        _blockOffset(blockSize),
+        _bytes(0),
+        _blocks(),
+        _objects()
+    {}
+    ~ObjectArena()
+    {
+        clear();
+    }
+
+private:
+    void* _allocate(std::size_t size);
+
+public:
+    /**
+     * 销毁内存区中的所有对象并释放内存块。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    void clear();
+    /**
+     * 内存区中的对象数量。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    inline std::size_t getObjectCount() const
+    {
+        return _objects.size();
+    }
+    /**
+     * 内存区中的对象所占的字节数。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    inline std::size_t getBytes() const
+    {
+        return _bytes;
+    }
+    /**
+     * 内存区分配的内存块数量。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    inline std::size_t getBlockCount() const
+    {
+        return _blocks.size();
+    }
+};
 
 DRAGONBONES_NAMESPACE_END
 #endif // DRAGONBONES_BASE_OBJECT_H
@@ -1,15 +1,23 @@
 #ifndef DRAGONBONES_H
 #define DRAGONBONES_H
 
+#include <cstddef>
 #include <cmath>
 #include <string>
 #include <algorithm>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <tuple>
 #include <functional>
 #include <sstream>
+#include <atomic>
+#include <mutex>
 #include <assert.h>
+#ifdef DRAGONBONES_PROFILE
+#include <chrono>
+#include <cstdint>
+#endif
 #ifdef WIN32
 #include <inttypes.h>
 #include <stdint.h>
@@ -40,7 +48,7 @@ public:\
 public:\
     static std::size_t getTypeIndex()\
     {\
-        static const auto typeIndex = typeid(CLASS).hash_code();\
+        static const auto typeIndex = BaseObject::_registerClassType(#CLASS, sizeof(CLASS), alignof(CLASS), [](void* memory) -> BaseObject* { return new (memory) CLASS(); });\
         return typeIndex;\
     }\
     virtual std::size_t getClassTypeIndex() const override\
@@ -60,7 +68,7 @@ private:\
 public:\
     static std::size_t getTypeIndex()\
     {\
-        static const auto typeIndex = typeid(CLASS).hash_code();\
+        static const auto typeIndex = BaseObject::_registerClassType(#CLASS, sizeof(CLASS), alignof(CLASS), [](void* memory) -> BaseObject* { return new (memory) CLASS(); });\
         return typeIndex;\
     }\
     virtual std::size_t getClassTypeIndex() const override\
@@ -79,6 +87,26 @@ private:\
     void operator=(const CLASS&);
 #endif
 
+// dragonBones profile, define DRAGONBONES_PROFILE to time the update scopes and count the updated objects.
+#ifdef DRAGONBONES_PROFILE
+#define DRAGONBONES_PROFILE_CONCAT_IMPL(A, B) A##B
+#define DRAGONBONES_PROFILE_CONCAT(A, B) DRAGONBONES_PROFILE_CONCAT_IMPL(A, B)
+#define DRAGONBONES_PROFILE_SCOPE(DRAGONBONES, SCOPE) \
+    const dragonBones::ProfileTimer DRAGONBONES_PROFILE_CONCAT(_profileTimer, __LINE__)(&(DRAGONBONES)->_profileStats, dragonBones::ProfileScope::SCOPE, nullptr)
+#define DRAGONBONES_PROFILE_NAMED_SCOPE(DRAGONBONES, SCOPE, NAME) \
+    const dragonBones::ProfileTimer DRAGONBONES_PROFILE_CONCAT(_profileTimer, __LINE__)(&(DRAGONBONES)->_profileStats, dragonBones::ProfileScope::SCOPE, &(NAME))
+#define DRAGONBONES_PROFILE_TRACE_SCOPE(SCOPE) \
+    const dragonBones::ProfileTimer DRAGONBONES_PROFILE_CONCAT(_profileTimer, __LINE__)(nullptr, dragonBones::ProfileScope::SCOPE, nullptr)
+#define DRAGONBONES_PROFILE_COUNT(DRAGONBONES, COUNTER, VALUE) do { \
+        (DRAGONBONES)->_profileStats.COUNTER += (VALUE); \
+    } while (0)
+#else
+#define DRAGONBONES_PROFILE_SCOPE(DRAGONBONES, SCOPE)
+#define DRAGONBONES_PROFILE_NAMED_SCOPE(DRAGONBONES, SCOPE, NAME)
+#define DRAGONBONES_PROFILE_TRACE_SCOPE(SCOPE)
+#define DRAGONBONES_PROFILE_COUNT(DRAGONBONES, COUNTER, VALUE) do {} while (0)
+#endif
+
 DRAGONBONES_NAMESPACE_BEGIN
 
 enum class BinaryOffset
@@ -218,6 +246,17 @@ enum class AnimationFadeOutMode {
     Single
 };
 
+enum class ArmatureUpdateMode {
+    Full,
+    TimeOnly
+};
+
+enum class CacheFrameFormat {
+    Float,
+    Half,
+    Fixed
+};
+
 template <class T>
 std::string to_string(const T& value)
 {
@@ -261,6 +300,8 @@ class Point;
 class Rectangle;
 
 class BaseObject;
+class ObjectArena;
+class ThreadPool;
 class UserData;
 class ActionData;
 class DragonBonesData;
@@ -290,6 +331,7 @@ class IArmatureProxy;
 class Armature;
 class TransformObject;
 class Bone;
+class PoseBuffer;
 class Slot;
 class Constraint;
 class IKConstraint;
@@ -315,6 +357,143 @@ class EventObject;
 
 class BaseFactory;
 class BuildArmaturePackage;
+class AnimationBakeTask;
+class AnimationCacheFile;
+
+#ifdef DRAGONBONES_PROFILE
+/**
+ * 性能分析的计时范围。 (包含嵌套的范围)
+ * @see dragonBones.ProfileStats
+ * @version DragonBones 5.1
+ * @language zh_CN
+ */
+enum class ProfileScope {
+    /**
+     * WorldClock::advanceTime()，只记录到追踪中。
+     */
+    Clock,
+    Armature,
+    Animation,
+    AnimationState,
+    UpdateTimelines,
+    Bones,
+    Slots,
+    Mesh
+};
+/**
+ * 性能分析的统计信息，定义 DRAGONBONES_PROFILE 时有效。
+ * 多线程更新时，时间为所有线程的时间之和。
+ * @see dragonBones.DragonBones#getProfileStats()
+ * @version DragonBones 5.1
+ * @language zh_CN
+ */
+class ProfileStats
+{
+public:
+    static const std::size_t SCOPE_COUNT = (std::size_t)ProfileScope::Mesh + 1;
+
+public:
+    /**
+     * 每个计时范围的时间。 (以纳秒为单位)
+     */
+    uint64_t scopeTimes[SCOPE_COUNT];
+    /**
+     * 每个计时范围的执行次数。
+     */
+    unsigned scopeCounts[SCOPE_COUNT];
+    /**
+     * 更新的时间轴数量。
+     */
+    unsigned timelineCount;
+    /**
+     * 重新计算全局变换的骨骼数量。
+     */
+    unsigned boneUpdateCount;
+    /**
+     * 使用缓存的骨骼数量。
+     */
+    unsigned boneCacheCount;
+    /**
+     * 重新计算顶点的网格数量。
+     */
+    unsigned meshUpdateCount;
+    /**
+     * 派发的事件数量。
+     */
+    unsigned eventCount;
+
+public:
+    ProfileStats()
+    {
+        clear();
+    }
+
+    inline void clear()
+    {
+        for (std::size_t i = 0; i < SCOPE_COUNT; ++i)
+        {
+            scopeTimes[i] = 0;
+            scopeCounts[i] = 0;
+        }
+
+        timelineCount = 0;
+        boneUpdateCount = 0;
+        boneCacheCount = 0;
+        meshUpdateCount = 0;
+        eventCount = 0;
+    }
+
+    inline void add(const ProfileStats& value)
+    {
+        for (std::size_t i = 0; i < SCOPE_COUNT; ++i)
+        {
+            scopeTimes[i] += value.scopeTimes[i];
+            scopeCounts[i] += value.scopeCounts[i];
+        }
+
+        timelineCount += value.timelineCount;
+        boneUpdateCount += value.boneUpdateCount;
+        boneCacheCount += value.boneCacheCount;
+        meshUpdateCount += value.meshUpdateCount;
+        eventCount += value.eventCount;
+    }
+
+    inline uint64_t getTime(ProfileScope scope) const
+    {
+        return scopeTimes[(std::size_t)scope];
+    }
+
+    inline unsigned getCount(ProfileScope scope) const
+    {
+        return scopeCounts[(std::size_t)scope];
+    }
+};
+/**
+ * @private
+ * 计时范围，结束时累加到统计信息，正在追踪时记录到 TraceRecorder。
+ * @see dragonBones.TraceRecorder
+ */
+class ProfileTimer
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(ProfileTimer)
+
+private:
+    ProfileStats* const _stats;
+    const ProfileScope _scope;
+    const std::string* const _name;
+    const std::chrono::steady_clock::time_point _start;
+
+public:
+    ProfileTimer(ProfileStats* stats, ProfileScope scope, const std::string* name) :
+        _stats(stats),
+        _scope(scope),
+        _name(name),
+        _start(std::chrono::steady_clock::now())
+    {
+    }
+    ~ProfileTimer(); // Defined in TraceRecorder.cpp.
+};
+#endif // DRAGONBONES_PROFILE
 /**
 * VERSION 5.1.0
 */
@@ -326,6 +505,15 @@ public:
     static bool yDown;
     static bool debug;
     static bool debugDraw;
+    /**
+     * 后端的显示对象是否可以在工作线程中更新，由工厂设置。
+     * 不能在工作线程中更新时，WorldClock 的并行更新会在当前线程中更新骨架。
+     * @default false
+     * @see dragonBones.WorldClock#setThreadCount()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    bool displayThreadSafe;
 
 private:
     std::vector<BaseObject*> _objects;
@@ -336,12 +524,14 @@ private:
 public:
 
     DragonBones() :
+        displayThreadSafe(false),
         _events(),
         _objects(),
         _clock(nullptr),
         _eventManager(nullptr)
     {}
     DragonBones(IEventDispatcher* value) :
+            displayThreadSafe(false),
             _events(),
             _objects(),
             _clock(nullptr),
@@ -367,6 +557,39 @@ public:
 public: // For WebAssembly.
     std::vector<BaseObject*>* getObjects() { return &_objects; }
     std::vector<EventObject*>* getEvents() { return &_events; }
+
+#ifdef DRAGONBONES_PROFILE
+public:
+    /**
+     * @private
+     */
+    ProfileStats _profileStats;
+
+private:
+    ProfileStats _frameProfileStats;
+
+public:
+    /**
+     * 上一帧的性能分析统计信息，定义 DRAGONBONES_PROFILE 时有效。
+     * @see #endProfileFrame()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    const ProfileStats& getProfileStats() const
+    {
+        return _frameProfileStats;
+    }
+    /**
+     * 结束当前帧的性能分析，保存统计信息并重新开始统计，每帧更新后调用一次。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    void endProfileFrame()
+    {
+        _frameProfileStats = _profileStats;
+        _profileStats.clear();
+    }
+#endif // DRAGONBONES_PROFILE
 };
 
 DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,153 @@
+#include "ThreadPool.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+thread_local bool ThreadPool::_isInTask = false;
+
+ThreadPool::ThreadPool(unsigned threadCount) :
+    _stopped(false),
+    _generation(0),
+    _pendingCount(0),
+    _mutex(),
+    _startCondition(),
+    _doneCondition(),
+    _threads(),
+    _workers()
+{
+    for (std::size_t i = 0; i <= threadCount; ++i) // The last worker is the thread which calls run().
+    {
+        _workers.push_back(new Worker());
+    }
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        _threads.push_back(std::thread(&ThreadPool::_threadMain, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+
+    _startCondition.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+
+    for (const auto worker : _workers)
+    {
+        delete worker;
+    }
+}
+
+bool ThreadPool::_popTask(std::size_t workerIndex, Task& task)
+{
+    {
+        auto& worker = *_workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty())
+        {
+            task = worker.tasks.back();
+            worker.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1, l = _workers.size(); i < l; ++i) // Steal.
+    {
+        auto& worker = *_workers[(workerIndex + i) % l];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty())
+        {
+            task = worker.tasks.front();
+            worker.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::_work(std::size_t workerIndex)
+{
+    Task task;
+    while (_popTask(workerIndex, task))
+    {
+        _isInTask = true;
+        (*task.function)(task.index);
+        _isInTask = false;
+
+        if (_pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _doneCondition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::_threadMain(std::size_t workerIndex)
+{
+    unsigned generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _startCondition.wait(lock, [&]() { return _stopped || _generation != generation; });
+            if (_stopped)
+            {
+                return;
+            }
+
+            generation = _generation;
+        }
+
+        _work(workerIndex);
+    }
+}
+
+void ThreadPool::run(unsigned taskCount, const std::function<void(unsigned)>& function)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    if (_isInTask)
+    {
+        DRAGONBONES_ASSERT(false, "Can not run tasks in a task.");
+        return;
+    }
+
+    const auto workerCount = _workers.size();
+    _pendingCount.store(taskCount, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        auto& worker = *_workers[i];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        for (unsigned index = i; index < taskCount; index += workerCount) // Round robin.
+        {
+            worker.tasks.push_back({ &function, index });
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _generation++;
+    }
+
+    _startCondition.notify_all();
+
+    _work(workerCount - 1);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondition.wait(lock, [&]() { return _pendingCount.load(std::memory_order_acquire) == 0; });
+}
+
+DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,79 @@
+#ifndef DRAGONBONES_THREAD_POOL_H
+#define DRAGONBONES_THREAD_POOL_H
+
+#include "DragonBones.h"
+#include <deque>
+#include <thread>
+#include <condition_variable>
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * @private
+ * 工作窃取线程池。
+ * 每个线程 (包括调用 run() 的线程) 有自己的任务队列，从队列尾部取任务，队列为空时从其他线程的队列头部窃取任务。
+ */
+class ThreadPool final
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(ThreadPool)
+
+private:
+    struct Task
+    {
+        const std::function<void(unsigned)>* function;
+        unsigned index;
+    };
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    static thread_local bool _isInTask;
+
+    bool _stopped;
+    unsigned _generation;
+    std::atomic<unsigned> _pendingCount;
+    std::mutex _mutex;
+    std::condition_variable _startCondition;
+    std::condition_variable _doneCondition;
+    std::vector<std::thread> _threads;
+    std::vector<Worker*> _workers;
+
+public:
+    /**
+     * @param threadCount 工作线程的数量。 (不包括调用 run() 的线程)
+     */
+    ThreadPool(unsigned threadCount);
+    ~ThreadPool();
+
+private:
+    bool _popTask(std::size_t workerIndex, Task& task);
+    void _work(std::size_t workerIndex);
+    void _threadMain(std::size_t workerIndex);
+
+public:
+    /**
+     * 执行任务并等待所有任务完成，调用的线程也会执行任务。
+     * @param taskCount 任务数量。
+     * @param function 任务，参数为任务索引。
+     */
+    void run(unsigned taskCount, const std::function<void(unsigned)>& function);
+    /**
+     * 工作线程的数量。
+     */
+    inline unsigned getThreadCount() const
+    {
+        return (unsigned)_threads.size();
+    }
+    /**
+     * 当前线程是否正在执行任务。 (任务中不能再调用 run())
+     */
+    static inline bool isInTask()
+    {
+        return _isInTask;
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_THREAD_POOL_H
@@ -0,0 +1,205 @@
+#include "TraceRecorder.h"
+
+#ifdef DRAGONBONES_PROFILE
+DRAGONBONES_NAMESPACE_BEGIN
+
+std::atomic<bool> TraceRecorder::_recording(false);
+unsigned TraceRecorder::_frameCount = 0;
+unsigned TraceRecorder::_frameIndex = 0;
+std::atomic<unsigned> TraceRecorder::_session(0);
+std::chrono::steady_clock::time_point TraceRecorder::_startTime;
+std::mutex TraceRecorder::_mutex;
+std::vector<TraceRecorder::ThreadBuffer*> TraceRecorder::_buffers;
+
+ProfileTimer::~ProfileTimer()
+{
+    const auto end = std::chrono::steady_clock::now();
+
+    if (_stats != nullptr)
+    {
+        const auto index = (std::size_t)_scope;
+        _stats->scopeTimes[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(end - _start).count();
+        _stats->scopeCounts[index]++;
+    }
+
+    if (TraceRecorder::isRecording())
+    {
+        TraceRecorder::_addEvent(_scope, _name, _start, end);
+    }
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::_getBuffer()
+{
+    static thread_local ThreadBuffer* buffer = nullptr;
+    static thread_local unsigned bufferSession = 0;
+
+    const auto session = _session.load(std::memory_order_acquire);
+    if (buffer == nullptr || bufferSession != session) // Register the thread once per recording.
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffer = new ThreadBuffer();
+        buffer->threadIndex = (unsigned)_buffers.size();
+        _buffers.push_back(buffer);
+        bufferSession = session;
+    }
+
+    return buffer;
+}
+
+const char* TraceRecorder::_getScopeName(ProfileScope scope)
+{
+    switch (scope)
+    {
+        case ProfileScope::Clock:
+            return "WorldClock";
+
+        case ProfileScope::Armature:
+            return "Armature";
+
+        case ProfileScope::Animation:
+            return "Animation";
+
+        case ProfileScope::AnimationState:
+            return "AnimationState";
+
+        case ProfileScope::UpdateTimelines:
+            return "UpdateTimelines";
+
+        case ProfileScope::Bones:
+            return "Bones";
+
+        case ProfileScope::Slots:
+            return "Slots";
+
+        case ProfileScope::Mesh:
+            return "Mesh";
+    }
+
+    return "";
+}
+
+void TraceRecorder::_addEvent(ProfileScope scope, const std::string* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end)
+{
+    const auto buffer = _getBuffer();
+    buffer->events.resize(buffer->events.size() + 1);
+
+    auto& event = buffer->events.back();
+    event.scope = scope;
+    if (name != nullptr)
+    {
+        event.name = *name;
+    }
+
+    event.start = start;
+    event.end = end;
+}
+
+void TraceRecorder::start(unsigned frameCount)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto buffer : _buffers)
+    {
+        delete buffer;
+    }
+
+    _buffers.clear();
+    _frameCount = frameCount;
+    _frameIndex = 0;
+    _startTime = std::chrono::steady_clock::now();
+    _session.fetch_add(1, std::memory_order_release);
+    _recording.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::stop()
+{
+    _recording.store(false, std::memory_order_release);
+}
+
+void TraceRecorder::endFrame()
+{
+    if (!isRecording())
+    {
+        return;
+    }
+
+    _getBuffer()->frames.push_back(std::chrono::steady_clock::now());
+
+    _frameIndex++;
+    if (_frameCount > 0 && _frameIndex >= _frameCount)
+    {
+        stop();
+    }
+}
+
+unsigned TraceRecorder::getRecordedFrameCount()
+{
+    return _frameIndex;
+}
+
+std::string TraceRecorder::toJSON()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto getTimestamp = [](const std::chrono::steady_clock::time_point& time) // Microseconds.
+    {
+        return std::chrono::duration<double, std::micro>(time - _startTime).count();
+    };
+
+    const auto writeString = [](std::ostringstream& stream, const std::string& value)
+    {
+        stream << "\"";
+        for (const auto c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                stream << '\\' << c;
+            }
+            else if ((unsigned char)c < 0x20)
+            {
+                stream << ' ';
+            }
+            else
+            {
+                stream << c;
+            }
+        }
+
+        stream << "\"";
+    };
+
+    std::ostringstream stream;
+    stream.precision(3);
+    stream << std::fixed;
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    auto isFirst = true;
+    for (const auto buffer : _buffers)
+    {
+        stream << (isFirst ? "" : ",");
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"args\":{\"name\":\"DragonBones " << buffer->threadIndex << "\"}}";
+        isFirst = false;
+
+        for (std::size_t i = 0, l = buffer->frames.size(); i < l; ++i)
+        {
+            stream << ",{\"name\":\"Frame " << i << "\",\"cat\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << buffer->threadIndex;
+            stream << ",\"ts\":" << getTimestamp(buffer->frames[i]) << "}";
+        }
+
+        for (const auto& event : buffer->events)
+        {
+            const auto scopeName = _getScopeName(event.scope);
+            stream << ",{\"name\":";
+            writeString(stream, event.name.empty() ? scopeName : event.name);
+            stream << ",\"cat\":\"" << scopeName << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex;
+            stream << ",\"ts\":" << getTimestamp(event.start) << ",\"dur\":" << getTimestamp(event.end) - getTimestamp(event.start) << "}";
+        }
+    }
+
+    stream << "]}";
+
+    return stream.str();
+}
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_PROFILE
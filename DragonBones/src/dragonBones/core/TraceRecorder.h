@@ -0,0 +1,96 @@
+#ifndef DRAGONBONES_TRACE_RECORDER_H
+#define DRAGONBONES_TRACE_RECORDER_H
+
+#include "DragonBones.h"
+
+#ifdef DRAGONBONES_PROFILE
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * 追踪记录器，定义 DRAGONBONES_PROFILE 时有效。
+ * 记录每帧更新中嵌套的计时范围 (时钟、骨架、动画、动画状态、骨骼、插槽和网格)，并导出为 Chrome trace_event JSON，
+ * 可以在 chrome://tracing 或 Perfetto 中查看。 骨架以骨架数据的名称标记。
+ * 每个线程单独记录，多线程更新时每个线程显示为一个轨道。
+ * @see dragonBones.ProfileScope
+ * @version DragonBones 5.1
+ * @language zh_CN
+ */
+class TraceRecorder final
+{
+private:
+    struct Event
+    {
+        ProfileScope scope;
+        std::string name;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    struct ThreadBuffer
+    {
+        unsigned threadIndex;
+        std::vector<Event> events;
+        std::vector<std::chrono::steady_clock::time_point> frames;
+    };
+
+    static std::atomic<bool> _recording;
+    static unsigned _frameCount;
+    static unsigned _frameIndex;
+    static std::atomic<unsigned> _session;
+    static std::chrono::steady_clock::time_point _startTime;
+    static std::mutex _mutex;
+    static std::vector<ThreadBuffer*> _buffers;
+
+    static ThreadBuffer* _getBuffer();
+    static const char* _getScopeName(ProfileScope scope);
+
+public:
+    /**
+     * @private
+     */
+    static void _addEvent(ProfileScope scope, const std::string* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end);
+    /**
+     * 清除已记录的数据并开始记录。 (不能在更新时调用)
+     * @param frameCount 记录的帧数，记录完成后自动停止。 [0: 直到调用 stop()]
+     * @see #endFrame()
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void start(unsigned frameCount = 1);
+    /**
+     * 停止记录，已记录的数据保留到下一次开始记录。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void stop();
+    /**
+     * 结束一帧，每帧更新后调用一次。 (工厂的全局时钟更新后会自动调用)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static void endFrame();
+    /**
+     * 是否正在记录。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static inline bool isRecording()
+    {
+        return _recording.load(std::memory_order_relaxed);
+    }
+    /**
+     * 已记录的帧数。
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static unsigned getRecordedFrameCount();
+    /**
+     * 将已记录的数据导出为 Chrome trace_event JSON。 (不能在更新时调用)
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    static std::string toJSON();
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_PROFILE
+#endif // DRAGONBONES_TRACE_RECORDER_H
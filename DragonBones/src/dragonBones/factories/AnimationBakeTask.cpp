@@ -0,0 +1,314 @@
+#include "AnimationBakeTask.h"
+#include "BaseFactory.h"
+#include "../model/DragonBonesData.h"
+#include "../model/AnimationData.h"
+#include "../armature/IArmatureProxy.h"
+#include "../animation/AnimationState.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* @private
+* 烘焙用的骨架代理，同时作为事件管理器，没有事件监听。
+*/
+class BakeArmatureProxy : public virtual IArmatureProxy
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(BakeArmatureProxy)
+
+private:
+    Armature* _armature;
+
+public:
+    BakeArmatureProxy() :
+        _armature(nullptr)
+    {}
+    virtual ~BakeArmatureProxy() {}
+
+    virtual void _init(Armature* armature) override
+    {
+        _armature = armature;
+    }
+    virtual void clear() override
+    {
+        _armature = nullptr;
+
+        delete this;
+    }
+    virtual void dispose(bool disposeProxy = true) override
+    {
+        if (_armature != nullptr)
+        {
+            _armature->dispose();
+            _armature = nullptr;
+        }
+    }
+    virtual void debugUpdate(bool isEnabled) override {}
+    virtual void _dispatchEvent(const std::string& type, EventObject* value) override {}
+    virtual void addEvent(const std::string& type, const std::function<void(EventObject*)>& listener) override {}
+    virtual void removeEvent(const std::string& type, const std::function<void(EventObject*)>& listener) override {}
+    virtual bool hasEvent(const std::string& type) const override
+    {
+        return false;
+    }
+    virtual Armature* getArmature() const override
+    {
+        return _armature;
+    }
+    virtual Animation* getAnimation() const override
+    {
+        return _armature->getAnimation();
+    }
+};
+/**
+* @private
+* 烘焙用的插槽，只计算变换，没有显示对象。
+*/
+class BakeSlot : public Slot
+{
+    BIND_CLASS_TYPE_A(BakeSlot);
+
+public:
+    /**
+    * 所有烘焙插槽共用的显示对象，只用于区分是否有显示对象。
+    */
+    static int display;
+
+protected:
+    virtual void _initDisplay(void* value) override {}
+    virtual void _disposeDisplay(void* value) override {}
+    virtual void _onUpdateDisplay() override {}
+    virtual void _addDisplay() override {}
+    virtual void _replaceDisplay(void* value, bool isArmatureDisplayContainer) override {}
+    virtual void _removeDisplay() override {}
+    virtual void _updateZOrder() override {}
+public:
+    virtual void _updateVisible() override {}
+    virtual void _updateBlendMode() override {}
+    virtual void _updateColor() override {}
+protected:
+    virtual void _updateFrame() override {}
+    virtual void _updateMesh() override {}
+    virtual void _updateTransform(bool isSkinnedMesh) override {}
+};
+
+int BakeSlot::display = 0;
+
+AnimationBakeTask::AnimationBakeTask(const BaseFactory* factory, const std::string& dragonBonesName, DragonBonesData* dragonBonesData, ArmatureData* armatureData, bool isSupportMesh) :
+    _isSupportMesh(isSupportMesh),
+    _deduplication(armatureData->cacheFrameDeduplication),
+    _published(false),
+    _frameCount(0),
+    _bakedFrameCount(0),
+    _completed(false),
+    _canceled(false),
+    _dragonBonesName(dragonBonesName),
+    _dragonBonesData(dragonBonesData),
+    _armatureData(armatureData),
+    _factory(factory),
+    _cachedSlots(armatureData->sortedSlots.size(), false),
+    _animationCaches(),
+    _thread()
+{
+    // The caches have been allocated in the current thread, their sizes do not change later.
+    for (const auto& pair : _armatureData->animations)
+    {
+        const auto animationData = pair.second;
+        _animationCaches.resize(_animationCaches.size() + 1);
+        auto& animationCache = _animationCaches.back();
+        animationCache.animationData = animationData;
+        animationCache.frameData.resize(animationData->getCachedFrameDataSize(), 0.0f);
+        animationCache.encoding.clear();
+        animationCache.encoding.format = armatureData->cacheFrameFormat;
+        _frameCount += animationData->cacheFrameCount;
+    }
+
+    _thread = std::thread(&AnimationBakeTask::_bake, this);
+}
+
+AnimationBakeTask::~AnimationBakeTask()
+{
+    cancel();
+}
+
+Armature* AnimationBakeTask::_buildArmature(DragonBones* dragonBones)
+{
+    BuildArmaturePackage dataPackage;
+    dataPackage.dataName = _dragonBonesName;
+    dataPackage.data = _dragonBonesData;
+    dataPackage.armature = _armatureData;
+    dataPackage.skin = _armatureData->defaultSkin;
+
+    const auto armature = BaseObject::borrowObject<Armature>();
+    const auto armatureProxy = new BakeArmatureProxy(); // Deleted by BakeArmatureProxy::clear().
+    armature->init(_armatureData, armatureProxy, armatureProxy, dragonBones);
+    armature->_cacheDisabled = true;
+
+    _factory->BaseFactory::_buildBones(dataPackage, *armature);
+
+    // Same as BaseFactory::_buildSlots() with the default skin, textures have been set in the calling thread.
+    const auto skin = dataPackage.skin;
+    for (const auto slotData : _armatureData->sortedSlots)
+    {
+        const auto displays = skin != nullptr ? skin->getDisplays(slotData->name) : nullptr;
+        if (displays == nullptr)
+        {
+            continue;
+        }
+
+        const auto slot = BaseObject::borrowObject<BakeSlot>();
+        slot->init(slotData, displays, &BakeSlot::display, &BakeSlot::display);
+
+        std::vector<std::pair<void*, DisplayType>> displayList;
+        for (const auto displayData : *displays)
+        {
+            if (displayData != nullptr && displayData->type == DisplayType::Image)
+            {
+                displayList.push_back(std::make_pair(&BakeSlot::display, DisplayType::Image));
+            }
+            else if (displayData != nullptr && displayData->type == DisplayType::Mesh)
+            {
+                displayList.push_back(std::make_pair(&BakeSlot::display, _isSupportMesh ? DisplayType::Mesh : DisplayType::Image));
+            }
+            else // Child armatures are not baked.
+            {
+                displayList.push_back(std::make_pair(nullptr, DisplayType::Image));
+            }
+        }
+
+        armature->addSlot(slot, slotData->parent->name);
+        slot->_setDisplayList(displayList);
+        slot->_setDisplayIndex(slotData->displayIndex, true);
+        _cachedSlots[slotData->index] = true;
+    }
+
+    armature->invalidUpdate("", true);
+    armature->advanceTime(0.0f);
+
+    return armature;
+}
+
+void AnimationBakeTask::_bake()
+{
+    const auto eventManager = new BakeArmatureProxy();
+    const auto dragonBones = new DragonBones(eventManager); // Events and objects of the baking armature are buffered in this thread.
+    const auto armature = _buildArmature(dragonBones);
+    // Slots without baked records are cached at runtime, Fixed ranges of the baked records can not quantize them.
+    const auto hasUncachedSlot = std::find(_cachedSlots.cbegin(), _cachedSlots.cend(), false) != _cachedSlots.cend();
+
+    for (auto& animationCache : _animationCaches)
+    {
+        if (hasUncachedSlot && animationCache.encoding.format == CacheFrameFormat::Fixed)
+        {
+            animationCache.encoding.format = CacheFrameFormat::Float;
+        }
+
+        const auto animationData = animationCache.animationData;
+        const auto animationState = armature->getAnimation()->gotoAndStopByTime(animationData->name, 0.0f);
+        if (animationState == nullptr)
+        {
+            _bakedFrameCount.fetch_add(animationData->cacheFrameCount, std::memory_order_relaxed);
+        }
+
+        for (unsigned i = 0; animationState != nullptr && i < animationData->cacheFrameCount; ++i)
+        {
+            if (_canceled.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            // The first time of each cache frame, the last frame is the end of the animation.
+            animationState->setCurrentTime(std::min(i / animationData->cacheFrameRate, animationData->duration));
+            armature->advanceTime(0.0f);
+
+            for (const auto bone : armature->getBones())
+            {
+                bone->updateGlobalTransform();
+                animationData->setCacheFrame(
+                    animationCache.frameData.data(), bone->globalTransformMatrix, bone->global,
+                    animationData->getBoneCacheFrameOffset(i, bone->boneData->index)
+                );
+            }
+
+            for (const auto slot : armature->getSlots())
+            {
+                slot->updateTransformAndMatrix(); // Slots without display are not updated.
+                slot->updateGlobalTransform();
+                animationData->setCacheFrame(
+                    animationCache.frameData.data(), slot->globalTransformMatrix, slot->global,
+                    animationData->getSlotCacheFrameOffset(i, slot->slotData->index)
+                );
+            }
+
+            _bakedFrameCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (animationCache.encoding.format != CacheFrameFormat::Float && !_canceled.load(std::memory_order_relaxed))
+        {
+            animationData->encodeCachedFrameData(animationCache.frameData, _cachedSlots, animationCache.compactFrameData, animationCache.encoding);
+            std::vector<float>().swap(animationCache.frameData);
+        }
+
+        if (_deduplication && !_canceled.load(std::memory_order_relaxed)) // Deduplicate the encoded records, more records are same after encoding.
+        {
+            if (animationCache.encoding.format == CacheFrameFormat::Float)
+            {
+                animationData->deduplicateCachedFrameData(animationCache.frameData, _cachedSlots, animationCache.recordOffsets);
+            }
+            else
+            {
+                animationData->deduplicateCachedFrameData(animationCache.compactFrameData, _cachedSlots, animationCache.recordOffsets);
+            }
+        }
+
+        dragonBones->advanceTime(0.0f); // Release buffered events and objects.
+    }
+
+    armature->dispose();
+    dragonBones->advanceTime(0.0f);
+    delete dragonBones;
+    delete eventManager;
+
+    _completed.store(!_canceled.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+bool AnimationBakeTask::_publish()
+{
+    if (_published || _canceled.load(std::memory_order_relaxed) || !isCompleted())
+    {
+        return _published;
+    }
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+
+    // All animations of the armature are replaced at once.
+    for (auto& animationCache : _animationCaches)
+    {
+        const auto recordOffsets = _deduplication ? &animationCache.recordOffsets : nullptr;
+        if (animationCache.encoding.format == CacheFrameFormat::Float)
+        {
+            animationCache.animationData->setCachedFrameData(animationCache.frameData, _cachedSlots, recordOffsets);
+        }
+        else
+        {
+            animationCache.animationData->setCachedFrameData(animationCache.compactFrameData, animationCache.encoding, _cachedSlots, recordOffsets);
+        }
+    }
+
+    _animationCaches.clear();
+    _published = true;
+
+    return true;
+}
+
+void AnimationBakeTask::cancel()
+{
+    _canceled.store(true, std::memory_order_relaxed);
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+DRAGONBONES_NAMESPACE_END
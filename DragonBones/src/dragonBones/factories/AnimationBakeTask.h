@@ -0,0 +1,117 @@
+#ifndef DRAGONBONES_ANIMATION_BAKE_TASK_H
+#define DRAGONBONES_ANIMATION_BAKE_TASK_H
+
+#include "../model/AnimationData.h"
+#include <thread>
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 动画帧缓存的烘焙任务，在工作线程中计算骨架所有动画每一个缓存帧的骨骼和插槽变换。
+* 工作线程使用不依赖渲染引擎的骨架，不读写正在使用的帧缓存，完成后由更新线程一次性发布到动画数据。
+* @see dragonBones.BaseFactory#bakeAnimations()
+* @see dragonBones.BaseFactory#publishBakedAnimations()
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class AnimationBakeTask final
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(AnimationBakeTask)
+
+private:
+    struct AnimationCache
+    {
+        AnimationData* animationData;
+        std::vector<float> frameData;
+        std::vector<uint16_t> compactFrameData;
+        std::vector<int> recordOffsets;
+        AnimationData::CacheFrameEncoding encoding;
+    };
+
+    bool _isSupportMesh;
+    bool _deduplication;
+    bool _published;
+    unsigned _frameCount;
+    std::atomic<unsigned> _bakedFrameCount;
+    std::atomic<bool> _completed;
+    std::atomic<bool> _canceled;
+    std::string _dragonBonesName;
+    DragonBonesData* _dragonBonesData;
+    ArmatureData* _armatureData;
+    const BaseFactory* _factory;
+    std::vector<bool> _cachedSlots;
+    std::vector<AnimationCache> _animationCaches;
+    std::thread _thread;
+
+public:
+    /**
+    * @private
+    */
+    AnimationBakeTask(const BaseFactory* factory, const std::string& dragonBonesName, DragonBonesData* dragonBonesData, ArmatureData* armatureData, bool isSupportMesh);
+    ~AnimationBakeTask();
+
+private:
+    Armature* _buildArmature(DragonBones* dragonBones);
+    void _bake();
+
+public:
+    /**
+    * 发布烘焙完成的帧缓存，只能在更新线程调用。
+    * @returns 是否已经发布。
+    * @private
+    */
+    bool _publish();
+    /**
+    * 停止烘焙并等待工作线程结束，已经烘焙的帧缓存不会发布。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    void cancel();
+    /**
+    * 烘焙进度。 [0~1]
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline float getProgress() const
+    {
+        return _frameCount > 0 ? (float)_bakedFrameCount.load(std::memory_order_relaxed) / _frameCount : 1.0f;
+    }
+    /**
+    * 是否已经烘焙完成。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline bool isCompleted() const
+    {
+        return _completed.load(std::memory_order_acquire);
+    }
+    /**
+    * 是否已经发布到动画数据。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline bool isPublished() const
+    {
+        return _published;
+    }
+    /**
+    * 龙骨数据名称。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline const std::string& getDragonBonesName() const
+    {
+        return _dragonBonesName;
+    }
+    /**
+    * 烘焙的骨架数据。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline ArmatureData* getArmatureData() const
+    {
+        return _armatureData;
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_ANIMATION_BAKE_TASK_H
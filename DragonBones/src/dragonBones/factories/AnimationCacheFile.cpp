@@ -0,0 +1,606 @@
+#include "AnimationCacheFile.h"
+#include "../model/DragonBonesData.h"
+#include "../model/ArmatureData.h"
+#include "../model/AnimationData.h"
+#include <cstring>
+#include <fstream>
+#ifdef WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+static const char CACHE_FILE_TAG[4] = { 'D', 'B', 'F', 'C' };
+/**
+* @private
+* 文件头之后的一个动画。
+*/
+struct AnimationCacheEntry
+{
+    AnimationData* animationData;
+    AnimationData::CacheFrameEncoding encoding;
+    float cacheFrameRate;
+    uint32_t cacheFrameCount;
+    uint32_t recordCount;
+    bool deduplicated;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint64_t recordOffsetsOffset;
+};
+
+template<class T>
+static void _writeValue(std::string& buffer, const T& value)
+{
+    buffer.append((const char*)&value, sizeof(T));
+}
+
+static void _writeString(std::string& buffer, const std::string& value)
+{
+    _writeValue(buffer, (uint32_t)value.size());
+    buffer.append(value);
+}
+/**
+* @private
+* 带边界检查的读取，越界后所有读取都失败。
+*/
+class CacheFileReader
+{
+private:
+    const char* _data;
+    std::size_t _size;
+    std::size_t _position;
+    bool _failed;
+
+public:
+    CacheFileReader(const char* data, std::size_t size) :
+        _data(data),
+        _size(size),
+        _position(0),
+        _failed(false)
+    {}
+
+    template<class T>
+    T readValue()
+    {
+        T value = T();
+        if (_failed || _size - _position < sizeof(T))
+        {
+            _failed = true;
+            return value;
+        }
+
+        std::memcpy(&value, _data + _position, sizeof(T));
+        _position += sizeof(T);
+
+        return value;
+    }
+
+    std::string readString()
+    {
+        const auto length = readValue<uint32_t>();
+        if (_failed || _size - _position < length)
+        {
+            _failed = true;
+            return "";
+        }
+
+        const std::string value(_data + _position, length);
+        _position += length;
+
+        return value;
+    }
+
+    inline bool isFailed() const
+    {
+        return _failed;
+    }
+};
+
+AnimationCacheFile::AnimationCacheFile() :
+    _dragonBonesName(),
+    _armatureData(nullptr),
+    _animations(),
+    _address(nullptr),
+    _size(0)
+#ifdef WIN32
+    ,
+    _fileHandle(nullptr),
+    _mappingHandle(nullptr)
+#endif
+{
+}
+
+AnimationCacheFile::~AnimationCacheFile()
+{
+    _unmap();
+}
+
+bool AnimationCacheFile::_map(const std::string& filePath)
+{
+#ifdef WIN32
+    const auto fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    // Copy on write, the pages are shared until they are written.
+    const auto mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mappingHandle == nullptr)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    const auto address = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+    if (address == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    _fileHandle = fileHandle;
+    _mappingHandle = mappingHandle;
+    _address = (char*)address;
+    _size = (std::size_t)fileSize.QuadPart;
+#else
+    const auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    // Copy on write, the pages are shared until they are written.
+    const auto address = mmap(nullptr, (std::size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor); // The mapping holds the file.
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+
+    _address = (char*)address;
+    _size = (std::size_t)fileStat.st_size;
+#endif
+
+    return true;
+}
+
+void AnimationCacheFile::_unmap()
+{
+    if (_address == nullptr)
+    {
+        return;
+    }
+
+#ifdef WIN32
+    UnmapViewOfFile(_address);
+    CloseHandle(_mappingHandle);
+    CloseHandle(_fileHandle);
+    _fileHandle = nullptr;
+    _mappingHandle = nullptr;
+#else
+    munmap(_address, _size);
+#endif
+
+    _address = nullptr;
+    _size = 0;
+}
+
+uint64_t AnimationCacheFile::getContentHash(const char* data, std::size_t size, float scale)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const auto mix = [&hash](const unsigned char* bytes, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    mix((const unsigned char*)data, size);
+    mix((const unsigned char*)&scale, sizeof(scale)); // The cached transforms are scaled.
+
+    return hash != 0 ? hash : 1; // 0 is unknown.
+}
+
+bool AnimationCacheFile::save(const std::string& filePath, const std::string& dragonBonesName, const DragonBonesData& dragonBonesData, const ArmatureData& armatureData)
+{
+    if (dragonBonesData.contentHash == 0)
+    {
+        DRAGONBONES_ASSERT(false, "Unknown content hash: " + dragonBonesName);
+        return false;
+    }
+
+    if (armatureData.cacheFrameRate == 0)
+    {
+        DRAGONBONES_ASSERT(false, "Armature frames have not been cached: " + armatureData.name);
+        return false;
+    }
+
+    const auto boneCount = armatureData.sortedBones.size();
+    const auto slotCount = armatureData.sortedSlots.size();
+    std::vector<bool> cachedSlots(slotCount, true);
+    // Deduplicated records are stored as they are, with the record offsets of each frame.
+    const auto getDataSize = [](const AnimationData* animationData)
+    {
+        return animationData->cacheFrameDeduplication ? animationData->getCachedFrameValueCount() : animationData->getCachedFrameDataSize();
+    };
+    const auto recordOffsetsSize = [boneCount, slotCount](const AnimationData* animationData)
+    {
+        return (std::size_t)animationData->cacheFrameCount * (boneCount + slotCount);
+    };
+
+    for (const auto& pair : armatureData.animations)
+    {
+        const auto animationData = pair.second;
+        if (animationData->cacheFrameRate <= 0.0f || animationData->getCachedFrameBytes() == nullptr)
+        {
+            DRAGONBONES_ASSERT(false, "Animation frames have not been cached: " + animationData->name);
+            return false;
+        }
+
+        for (const auto bone : armatureData.sortedBones)
+        {
+            const auto& indices = animationData->boneCachedFrameIndices.at(bone->name);
+            if (std::find_if(indices.cbegin(), indices.cend(), [](int index) { return index < 0; }) != indices.cend())
+            {
+                DRAGONBONES_ASSERT(false, "Animation frames have not been cached: " + animationData->name);
+                return false;
+            }
+        }
+
+        for (const auto slot : armatureData.sortedSlots)
+        {
+            const auto& indices = animationData->slotCachedFrameIndices.at(slot->name);
+            if (std::find_if(indices.cbegin(), indices.cend(), [](int index) { return index < 0; }) != indices.cend())
+            {
+                cachedSlots[slot->index] = false; // Cache at runtime after loading.
+            }
+        }
+    }
+
+    std::string header;
+    header.append(CACHE_FILE_TAG, sizeof(CACHE_FILE_TAG));
+    _writeValue(header, (uint32_t)VERSION);
+    _writeValue(header, dragonBonesData.contentHash);
+    _writeValue(header, (uint32_t)armatureData.cacheFrameRate);
+    _writeValue(header, (uint32_t)boneCount);
+    _writeValue(header, (uint32_t)slotCount);
+    _writeValue(header, (uint32_t)armatureData.animations.size());
+    _writeString(header, dragonBonesName);
+    _writeString(header, armatureData.name);
+
+    for (const auto isCached : cachedSlots)
+    {
+        _writeValue(header, (uint8_t)(isCached ? 1 : 0));
+    }
+
+    std::vector<std::size_t> offsetPositions;
+    for (const auto& pair : armatureData.animations)
+    {
+        const auto animationData = pair.second;
+        _writeString(header, animationData->name);
+        _writeValue(header, animationData->cacheFrameRate);
+        _writeValue(header, (uint32_t)animationData->cacheFrameCount);
+        _writeValue(header, (uint32_t)animationData->cacheFrameEncoding.format);
+        _writeValue(header, animationData->cacheFrameEncoding.ranges);
+        _writeValue(header, animationData->cacheFrameEncoding.errors);
+        _writeValue(header, (uint32_t)animationData->cacheFrameEncoding.clampCount);
+        _writeValue(header, (uint32_t)(animationData->cacheFrameDeduplication ? 1 : 0));
+        _writeValue(header, (uint32_t)(getDataSize(animationData) / AnimationData::CACHE_FRAME_SIZE));
+        offsetPositions.push_back(header.size());
+        _writeValue(header, (uint64_t)0); // Set later.
+        _writeValue(header, (uint64_t)getDataSize(animationData));
+        _writeValue(header, (uint64_t)0); // Set later.
+    }
+
+    const auto align = [](uint64_t value) { return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT; };
+    auto dataOffset = align(header.size());
+    std::size_t animationIndex = 0;
+    for (const auto& pair : armatureData.animations)
+    {
+        const auto animationData = pair.second;
+        const auto offsetPosition = offsetPositions[animationIndex++];
+        std::memcpy(&header[offsetPosition], &dataOffset, sizeof(dataOffset));
+        dataOffset = align(dataOffset + getDataSize(animationData) * animationData->getCacheFrameValueSize());
+
+        if (animationData->cacheFrameDeduplication)
+        {
+            std::memcpy(&header[offsetPosition + sizeof(uint64_t) * 2], &dataOffset, sizeof(dataOffset));
+            dataOffset = align(dataOffset + recordOffsetsSize(animationData) * sizeof(int32_t));
+        }
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(header.data(), header.size());
+
+    std::vector<char> frameData;
+    std::vector<int32_t> recordOffsets;
+    const std::string padding(DATA_ALIGNMENT, '\0');
+    auto position = (uint64_t)header.size();
+    for (const auto& pair : armatureData.animations)
+    {
+        const auto animationData = pair.second;
+        const auto frameBytes = animationData->getCachedFrameBytes();
+        const auto valueSize = animationData->getCacheFrameValueSize();
+        const auto recordSize = AnimationData::CACHE_FRAME_SIZE * valueSize;
+
+        if (animationData->cacheFrameDeduplication)
+        {
+            recordOffsets.assign(recordOffsetsSize(animationData), -1);
+            for (unsigned i = 0; i < animationData->cacheFrameCount; ++i)
+            {
+                const auto frameOffset = i * (boneCount + slotCount);
+                for (const auto bone : armatureData.sortedBones)
+                {
+                    recordOffsets[frameOffset + bone->index] = animationData->boneCachedFrameIndices.at(bone->name)[i];
+                }
+
+                for (const auto slot : armatureData.sortedSlots)
+                {
+                    if (cachedSlots[slot->index])
+                    {
+                        recordOffsets[frameOffset + boneCount + slot->index] = animationData->slotCachedFrameIndices.at(slot->name)[i];
+                    }
+                }
+            }
+
+            // The records of the uncached slots are stored too, they are not referred after loading.
+            const auto dataSize = animationData->getCachedFrameValueCount() * valueSize;
+            auto alignedPosition = align(position);
+            file.write(padding.data(), (std::streamsize)(alignedPosition - position));
+            if (dataSize > 0)
+            {
+                file.write(frameBytes, (std::streamsize)dataSize);
+            }
+
+            position = alignedPosition + dataSize;
+            alignedPosition = align(position);
+            file.write(padding.data(), (std::streamsize)(alignedPosition - position));
+            file.write((const char*)recordOffsets.data(), (std::streamsize)(recordOffsets.size() * sizeof(int32_t)));
+            position = alignedPosition + recordOffsets.size() * sizeof(int32_t);
+            continue;
+        }
+
+        frameData.assign(animationData->getCachedFrameDataSize() * valueSize, 0);
+
+        // A frame may refer to the record of the previous frame, every record is stored in its own place.
+        for (unsigned i = 0; i < animationData->cacheFrameCount; ++i)
+        {
+            for (const auto bone : armatureData.sortedBones)
+            {
+                const auto index = animationData->boneCachedFrameIndices.at(bone->name)[i];
+                std::copy_n(frameBytes + index * valueSize, recordSize, frameData.data() + animationData->getBoneCacheFrameOffset(i, bone->index) * valueSize);
+            }
+
+            for (const auto slot : armatureData.sortedSlots)
+            {
+                if (cachedSlots[slot->index])
+                {
+                    const auto index = animationData->slotCachedFrameIndices.at(slot->name)[i];
+                    std::copy_n(frameBytes + index * valueSize, recordSize, frameData.data() + animationData->getSlotCacheFrameOffset(i, slot->index) * valueSize);
+                }
+            }
+        }
+
+        const auto alignedPosition = align(position);
+        file.write(padding.data(), (std::streamsize)(alignedPosition - position));
+        file.write(frameData.data(), (std::streamsize)frameData.size());
+        position = alignedPosition + frameData.size();
+    }
+
+    return (bool)file;
+}
+
+AnimationCacheFile* AnimationCacheFile::load(const std::string& filePath, const std::string& dragonBonesName, const DragonBonesData& dragonBonesData, ArmatureData& armatureData)
+{
+    const auto cacheFile = new AnimationCacheFile();
+    if (!cacheFile->_map(filePath))
+    {
+        delete cacheFile;
+        return nullptr;
+    }
+
+    // Check the whole file before changing the data.
+    CacheFileReader reader(cacheFile->_address, cacheFile->_size);
+    char tag[sizeof(CACHE_FILE_TAG)];
+    for (auto& c : tag)
+    {
+        c = reader.readValue<char>();
+    }
+
+    const auto version = reader.readValue<uint32_t>();
+    const auto contentHash = reader.readValue<uint64_t>();
+    const auto frameRate = reader.readValue<uint32_t>();
+    const auto boneCount = reader.readValue<uint32_t>();
+    const auto slotCount = reader.readValue<uint32_t>();
+    const auto animationCount = reader.readValue<uint32_t>();
+    const auto fileDragonBonesName = reader.readString();
+    const auto armatureName = reader.readString();
+
+    auto isValid =
+        !reader.isFailed() &&
+        std::memcmp(tag, CACHE_FILE_TAG, sizeof(CACHE_FILE_TAG)) == 0 &&
+        version == VERSION &&
+        contentHash != 0 && contentHash == dragonBonesData.contentHash &&
+        frameRate > 0 && (armatureData.cacheFrameRate == 0 || armatureData.cacheFrameRate == frameRate) &&
+        boneCount == armatureData.sortedBones.size() &&
+        slotCount == armatureData.sortedSlots.size() &&
+        animationCount == armatureData.animations.size() &&
+        fileDragonBonesName == dragonBonesName &&
+        armatureName == armatureData.name;
+
+    std::vector<bool> cachedSlots;
+    std::vector<AnimationCacheEntry> entries;
+    if (isValid)
+    {
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            cachedSlots.push_back(reader.readValue<uint8_t>() != 0);
+        }
+
+        for (uint32_t i = 0; i < animationCount; ++i)
+        {
+            AnimationCacheEntry entry;
+            entry.animationData = armatureData.getAnimation(reader.readString());
+            entry.cacheFrameRate = reader.readValue<float>();
+            entry.cacheFrameCount = reader.readValue<uint32_t>();
+            entry.encoding.format = (CacheFrameFormat)reader.readValue<uint32_t>();
+            for (auto& value : entry.encoding.ranges)
+            {
+                value = reader.readValue<float>();
+            }
+
+            for (auto& value : entry.encoding.errors)
+            {
+                value = reader.readValue<float>();
+            }
+
+            entry.encoding.clampCount = reader.readValue<uint32_t>();
+            entry.deduplicated = reader.readValue<uint32_t>() != 0;
+            entry.recordCount = reader.readValue<uint32_t>();
+            entry.dataOffset = reader.readValue<uint64_t>();
+            entry.dataSize = reader.readValue<uint64_t>();
+            entry.recordOffsetsOffset = reader.readValue<uint64_t>();
+
+            const auto valueSize = entry.encoding.format == CacheFrameFormat::Float ? sizeof(float) : sizeof(uint16_t);
+            const auto recordOffsetsSize = (uint64_t)entry.cacheFrameCount * (boneCount + slotCount);
+
+            if (
+                reader.isFailed() ||
+                entry.animationData == nullptr ||
+                (unsigned)entry.encoding.format > (unsigned)CacheFrameFormat::Fixed ||
+                (entry.encoding.format == CacheFrameFormat::Fixed && std::find(cachedSlots.cbegin(), cachedSlots.cend(), false) != cachedSlots.cend()) ||
+                entry.dataOffset % DATA_ALIGNMENT != 0 ||
+                entry.dataOffset > cacheFile->_size ||
+                entry.dataSize > (cacheFile->_size - entry.dataOffset) / valueSize ||
+                entry.dataSize != (uint64_t)entry.recordCount * AnimationData::CACHE_FRAME_SIZE ||
+                (
+                    entry.deduplicated && (
+                        entry.recordOffsetsOffset % DATA_ALIGNMENT != 0 ||
+                        entry.recordOffsetsOffset > cacheFile->_size ||
+                        recordOffsetsSize > (cacheFile->_size - entry.recordOffsetsOffset) / sizeof(int32_t)
+                    )
+                )
+            )
+            {
+                isValid = false;
+                break;
+            }
+
+            if (entry.deduplicated) // Every record offset must refer to a stored record.
+            {
+                const auto recordOffsets = (const int32_t*)(cacheFile->_address + entry.recordOffsetsOffset);
+                for (uint64_t j = 0; j < recordOffsetsSize; ++j)
+                {
+                    const auto recordIndex = (unsigned)(j % (boneCount + slotCount));
+                    const auto isCached = recordIndex < boneCount || cachedSlots[recordIndex - boneCount];
+                    const auto recordOffset = recordOffsets[j];
+                    if (
+                        isCached ?
+                        (recordOffset < 0 || (uint64_t)recordOffset >= entry.dataSize || recordOffset % AnimationData::CACHE_FRAME_SIZE != 0) :
+                        recordOffset != -1
+                    )
+                    {
+                        isValid = false;
+                        break;
+                    }
+                }
+
+                if (!isValid)
+                {
+                    break;
+                }
+            }
+
+            entries.push_back(entry);
+        }
+    }
+
+    if (!isValid)
+    {
+        DRAGONBONES_ASSERT(false, "Animation cache file mismatch: " + filePath);
+        delete cacheFile;
+        return nullptr;
+    }
+
+    // The frames the animations will have at the file's rate, nothing is cached until everything matches.
+    for (const auto& entry : entries)
+    {
+        const auto animationData = entry.animationData;
+        float cacheFrameRate = 0.0f;
+        unsigned cacheFrameCount = 0;
+        animationData->getCacheFrameInfo(frameRate, cacheFrameRate, cacheFrameCount);
+        const auto denseSize = (uint64_t)cacheFrameCount * (boneCount + slotCount) * AnimationData::CACHE_FRAME_SIZE;
+        if (
+            cacheFrameRate != entry.cacheFrameRate ||
+            cacheFrameCount != entry.cacheFrameCount ||
+            (!entry.deduplicated && denseSize != entry.dataSize)
+        )
+        {
+            DRAGONBONES_ASSERT(false, "Animation cache file mismatch: " + filePath + ", " + animationData->name);
+            delete cacheFile;
+            return nullptr;
+        }
+    }
+
+    armatureData.cacheFrames(frameRate);
+
+    // Replacing the records updates the cache generation, running armatures of the data drop their cached offsets.
+    for (const auto& entry : entries)
+    {
+        const auto recordOffsets = entry.deduplicated ? (const int*)(cacheFile->_address + entry.recordOffsetsOffset) : nullptr;
+        entry.animationData->setCachedFrameData(cacheFile->_address + entry.dataOffset, entry.encoding, entry.recordCount, recordOffsets, cachedSlots);
+        cacheFile->_animations.push_back(entry.animationData);
+    }
+
+    cacheFile->_dragonBonesName = dragonBonesName;
+    cacheFile->_armatureData = &armatureData;
+
+    return cacheFile;
+}
+
+void AnimationCacheFile::_copyData()
+{
+    for (const auto animationData : _animations)
+    {
+        const auto frameBytes = animationData->getCachedFrameBytes();
+        if (frameBytes >= _address && frameBytes < _address + _size)
+        {
+            animationData->copyCachedFrameData();
+        }
+    }
+
+    _animations.clear();
+}
+
+DRAGONBONES_NAMESPACE_END
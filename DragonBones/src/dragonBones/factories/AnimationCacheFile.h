@@ -0,0 +1,96 @@
+#ifndef DRAGONBONES_ANIMATION_CACHE_FILE_H
+#define DRAGONBONES_ANIMATION_CACHE_FILE_H
+
+#include "../core/DragonBones.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 动画帧缓存文件，保存骨架所有动画的骨骼和插槽帧缓存，加载时映射到内存，动画数据直接使用映射的内存，不需要计算。
+* 文件以龙骨数据名称、骨架名称、动画名称、缓存帧率和源数据的内容哈希校验，任意一项不一致时不能加载。
+* 映射为写时复制，同一台设备上的多个进程共享只读的内存页，播放时缓存的插槽 (没有烘焙的插槽) 只复制写入的内存页。
+* 帧缓存以动画数据正在使用的格式保存，压缩格式的编码范围一起保存。 文件使用本机的字节序和浮点数格式，不能在不同架构之间共用。
+* 去重的帧缓存保存不同的记录和每帧每个骨骼和插槽记录的位置，加载后仍然是去重的。
+* @see dragonBones.BaseFactory#saveBakedAnimations()
+* @see dragonBones.BaseFactory#loadBakedAnimations()
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class AnimationCacheFile final
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(AnimationCacheFile)
+
+public:
+    /**
+    * @private
+    */
+    static const unsigned VERSION = 3;
+    /**
+    * 帧数据在文件中的对齐字节数。
+    * @private
+    */
+    static const unsigned DATA_ALIGNMENT = 64;
+
+private:
+    std::string _dragonBonesName;
+    ArmatureData* _armatureData;
+    std::vector<AnimationData*> _animations;
+    char* _address;
+    std::size_t _size;
+#ifdef WIN32
+    void* _fileHandle;
+    void* _mappingHandle;
+#endif
+
+    AnimationCacheFile();
+
+    bool _map(const std::string& filePath);
+    void _unmap();
+
+public:
+    ~AnimationCacheFile();
+    /**
+    * 计算源数据的内容哈希。 (FNV-1a)
+    * @param data 源数据。
+    * @param size 源数据的字节数。
+    * @param scale 解析时的缩放。
+    * @private
+    */
+    static uint64_t getContentHash(const char* data, std::size_t size, float scale);
+    /**
+    * 保存骨架所有动画的帧缓存，所有动画的所有骨骼需要已经缓存。 (只能在更新线程调用)
+    * 没有缓存全部帧的插槽不保存，加载后在播放时缓存。
+    * @private
+    */
+    static bool save(const std::string& filePath, const std::string& dragonBonesName, const DragonBonesData& dragonBonesData, const ArmatureData& armatureData);
+    /**
+    * 映射帧缓存文件并设置骨架所有动画的帧缓存，文件和数据不一致时返回 nullptr，不修改动画数据。 (只能在更新线程调用)
+    * @private
+    */
+    static AnimationCacheFile* load(const std::string& filePath, const std::string& dragonBonesName, const DragonBonesData& dragonBonesData, ArmatureData& armatureData);
+    /**
+    * 将仍在使用映射内存的动画数据的帧缓存复制到动画数据，解除映射后动画数据仍然可以使用。
+    * @private
+    */
+    void _copyData();
+    /**
+    * 龙骨数据名称。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline const std::string& getDragonBonesName() const
+    {
+        return _dragonBonesName;
+    }
+    /**
+    * 使用帧缓存文件的骨架数据。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline ArmatureData* getArmatureData() const
+    {
+        return _armatureData;
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_ANIMATION_CACHE_FILE_H
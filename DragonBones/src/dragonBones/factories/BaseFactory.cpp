@@ -1,9 +1,15 @@
 #include "BaseFactory.h"
+#include "../model/DisplayData.h"
+#include "../model/AnimationConfig.h"
+#include "../model/AnimationData.h"
+#include "../animation/AnimationState.h"
+#include "../animation/TimelineState.h"
+#include "../events/EventObject.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 
-JSONDataParser BaseFactory::_jsonParser;
-BinaryDataParser BaseFactory::_binaryParser;
+thread_local JSONDataParser BaseFactory::_jsonParser;
+thread_local BinaryDataParser BaseFactory::_binaryParser;
 
 TextureData* BaseFactory::_getTextureData(const std::string& textureAtlasName, const std::string& textureName) const
 {
@@ -132,7 +138,7 @@ void BaseFactory::_buildBones(const BuildArmaturePackage& dataPackage, Armature&
 
         for (const auto constraintData : boneData->constraints)
         {
-            const auto target = armature.getBone(constraintData->target->name);
+            const auto target = armature.getBoneByNameId(constraintData->target->nameId);
             if (target == nullptr) 
             {
                 continue;
@@ -141,7 +147,7 @@ void BaseFactory::_buildBones(const BuildArmaturePackage& dataPackage, Armature&
             // TODO more constraint type.
             const auto ikConstraintData = static_cast<IKConstraintData*>(constraintData);
             const auto constraint = BaseObject::borrowObject<IKConstraint>();
-            const auto root = ikConstraintData->root != nullptr ? armature.getBone(ikConstraintData->root->name) : nullptr;
+            const auto root = ikConstraintData->root != nullptr ? armature.getBoneByNameId(ikConstraintData->root->nameId) : nullptr;
             constraint->target = target;
             constraint->bone = bone;
             constraint->root = root;
@@ -296,6 +302,154 @@ std::pair<void*, DisplayType> BaseFactory::_getSlotDisplay(const BuildArmaturePa
     return display;
 }
 
+void BaseFactory::_getObjectCensus(const BuildArmaturePackage& dataPackage, std::map<std::size_t, unsigned>& census) const
+{
+    const auto armatureData = dataPackage.armature;
+    const auto currentSkin = dataPackage.skin;
+    const auto defaultSkin = armatureData->defaultSkin;
+
+    census[Armature::getTypeIndex()] += 1;
+    census[Animation::getTypeIndex()] += 1;
+    census[AnimationConfig::getTypeIndex()] += 1;
+    census[Bone::getTypeIndex()] += armatureData->sortedBones.size();
+
+    for (const auto boneData : armatureData->sortedBones)
+    {
+        census[IKConstraint::getTypeIndex()] += boneData->constraints.size();
+    }
+
+    // Same skin merging as _buildSlots().
+    std::map<std::string, std::vector<DisplayData*>*> skinSlots;
+    if (currentSkin != nullptr && defaultSkin != nullptr)
+    {
+        for (auto& pair : defaultSkin->displays)
+        {
+            skinSlots[pair.first] = &pair.second;
+        }
+
+        if (currentSkin != defaultSkin)
+        {
+            for (auto& pair : currentSkin->displays)
+            {
+                skinSlots[pair.first] = &pair.second;
+            }
+        }
+    }
+
+    const auto slotClassTypeIndex = _getSlotClassTypeIndex();
+    if (slotClassTypeIndex > 0)
+    {
+        census[slotClassTypeIndex] += skinSlots.size();
+    }
+
+    for (const auto& pair : skinSlots)
+    {
+        for (const auto displayData : *pair.second)
+        {
+            if (displayData != nullptr && displayData->type == DisplayType::Armature)
+            {
+                BuildArmaturePackage childPackage;
+                if (_fillBuildArmaturePackage(childPackage, dataPackage.dataName, displayData->name, "", dataPackage.textureAtlasName))
+                {
+                    _getObjectCensus(childPackage, census);
+                }
+            }
+        }
+    }
+
+    // One animation state at a time, take the largest animation.
+    std::map<std::size_t, unsigned> animationCensus;
+    for (const auto& animationPair : armatureData->animations)
+    {
+        const auto animationData = animationPair.second;
+        std::map<std::size_t, unsigned> stateCensus;
+        stateCensus[AnimationState::getTypeIndex()] = 1;
+        stateCensus[ActionTimelineState::getTypeIndex()] = 1;
+        stateCensus[ZOrderTimelineState::getTypeIndex()] = animationData->zOrderTimeline != nullptr ? 1 : 0;
+        stateCensus[EventObject::getTypeIndex()] = 3; // Fade in, start and fade in complete events of the first frames, frame events are not counted.
+
+        for (const auto boneData : armatureData->sortedBones)
+        {
+            stateCensus[BonePose::getTypeIndex()] += 1;
+
+            const auto timelineDatas = animationData->getBoneTimelines(boneData->name);
+            if (timelineDatas != nullptr)
+            {
+                for (const auto timelineData : *timelineDatas)
+                {
+                    if (timelineData->type == TimelineType::BoneAll)
+                    {
+                        stateCensus[BoneAllTimelineState::getTypeIndex()] += 1;
+                    }
+                }
+            }
+            else
+            {
+                stateCensus[BoneAllTimelineState::getTypeIndex()] += 1; // Pose timeline.
+            }
+        }
+
+        for (const auto& pair : skinSlots)
+        {
+            unsigned displayIndexCount = 0;
+            unsigned colorCount = 0;
+            unsigned ffdCount = 0;
+            unsigned meshCount = 0;
+            const auto timelineDatas = animationData->getSlotTimeline(pair.first);
+            if (timelineDatas != nullptr)
+            {
+                for (const auto timelineData : *timelineDatas)
+                {
+                    switch (timelineData->type)
+                    {
+                        case TimelineType::SlotDisplayIndex:
+                            displayIndexCount++;
+                            break;
+
+                        case TimelineType::SlotColor:
+                            colorCount++;
+                            break;
+
+                        case TimelineType::SlotFFD:
+                            ffdCount++;
+                            break;
+
+                        default:
+                            break;
+                    }
+                }
+            }
+
+            for (const auto displayData : *pair.second)
+            {
+                if (displayData != nullptr && displayData->type == DisplayType::Mesh)
+                {
+                    meshCount++;
+                }
+            }
+
+            // Pose timelines.
+            stateCensus[SlotDislayIndexTimelineState::getTypeIndex()] += displayIndexCount > 0 ? displayIndexCount : 1;
+            stateCensus[SlotColorTimelineState::getTypeIndex()] += colorCount > 0 ? colorCount : 1;
+            stateCensus[SlotFFDTimelineState::getTypeIndex()] += ffdCount > meshCount ? ffdCount : meshCount;
+        }
+
+        for (const auto& pair : stateCensus)
+        {
+            auto& count = animationCensus[pair.first];
+            if (pair.second > count)
+            {
+                count = pair.second;
+            }
+        }
+    }
+
+    for (const auto& pair : animationCensus)
+    {
+        census[pair.first] += pair.second;
+    }
+}
+
 void BaseFactory::_replaceSlotDisplay(const BuildArmaturePackage& dataPackage, DisplayData* displayData, Slot& slot, int displayIndex) const
 {
     if (displayIndex < 0)
@@ -343,24 +497,24 @@ DragonBonesData* BaseFactory::parseDragonBonesData(const char* rawData, const st
 
     DragonBonesData* dragonBonesData = nullptr;
 
-    if (
+    const auto isBinary =
         rawData[0] == 'D' &&
         rawData[1] == 'B' &&
         rawData[2] == 'D' &&
-        rawData[3] == 'T'
-    )
+        rawData[3] == 'T';
+    if (isBinary)
     {
         dragonBonesData = BaseFactory::_binaryParser.parseDragonBonesData(rawData, scale);
     }
     else 
     {
-        dragonBonesData = _dataParser->parseDragonBonesData(rawData, scale);
+        dragonBonesData = _getDataParser()->parseDragonBonesData(rawData, scale);
     }
 
     while (true) 
     {
         const auto textureAtlasData = _buildTextureAtlasData(nullptr, nullptr);
-        if (_dataParser->parseTextureAtlasData(nullptr, *textureAtlasData, scale))
+        if (_getDataParser()->parseTextureAtlasData(nullptr, *textureAtlasData, scale))
         {
             addTextureAtlasData(textureAtlasData, name);
         }
@@ -373,6 +527,11 @@ DragonBonesData* BaseFactory::parseDragonBonesData(const char* rawData, const st
         
     if (dragonBonesData != nullptr)
     {
+        if (!isBinary) // The size of binary data is unknown, the factory which loads the file sets the hash.
+        {
+            dragonBonesData->contentHash = AnimationCacheFile::getContentHash(rawData, strlen(rawData), scale);
+        }
+
         addDragonBonesData(dragonBonesData, name);
     }
 
@@ -382,7 +541,7 @@ DragonBonesData* BaseFactory::parseDragonBonesData(const char* rawData, const st
 TextureAtlasData* BaseFactory::parseTextureAtlasData(const char* rawData, void* textureAtlas, const std::string& name, float scale)
 {
     const auto textureAtlasData = _buildTextureAtlasData(nullptr, nullptr);
-    _dataParser->parseTextureAtlasData(rawData, *textureAtlasData, scale);
+    _getDataParser()->parseTextureAtlasData(rawData, *textureAtlasData, scale);
     _buildTextureAtlasData(textureAtlasData, textureAtlas);
     addTextureAtlasData(textureAtlasData, name);
 
@@ -408,6 +567,39 @@ void BaseFactory::addDragonBonesData(DragonBonesData* data, const std::string& n
 
 void BaseFactory::removeDragonBonesData(const std::string& name, bool disposeData)
 {
+    for (std::size_t i = 0; i < _bakeTasks.size();)
+    {
+        const auto bakeTask = _bakeTasks[i];
+        if (bakeTask->getDragonBonesName() == name)
+        {
+            delete bakeTask; // Stop baking.
+            _bakeTasks.erase(_bakeTasks.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    for (std::size_t i = 0; i < _cacheFiles.size();)
+    {
+        const auto cacheFile = _cacheFiles[i];
+        if (cacheFile->getDragonBonesName() == name)
+        {
+            if (!disposeData)
+            {
+                cacheFile->_copyData(); // The data is still available after unmapping.
+            }
+
+            delete cacheFile;
+            _cacheFiles.erase(_cacheFiles.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
     const auto iterator = _dragonBonesDataMap.find(name);
     if (iterator != _dragonBonesDataMap.cend())
     {
@@ -460,6 +652,25 @@ ArmatureData* BaseFactory::getArmatureData(const std::string& name, const std::s
 
 void BaseFactory::clear(bool disposeData)
 {
+    for (const auto bakeTask : _bakeTasks)
+    {
+        delete bakeTask; // Stop baking.
+    }
+
+    _bakeTasks.clear();
+
+    for (const auto cacheFile : _cacheFiles)
+    {
+        if (!disposeData)
+        {
+            cacheFile->_copyData(); // The data is still available after unmapping.
+        }
+
+        delete cacheFile;
+    }
+
+    _cacheFiles.clear();
+
     if (disposeData)
     {
         for (const auto& pair : _dragonBonesDataMap)
@@ -498,6 +709,144 @@ Armature * BaseFactory::buildArmature(const std::string& armatureName, const std
     return armature;
 }
 
+bool BaseFactory::prewarm(const std::string& armatureName, const std::string& dragonBonesName, unsigned count) const
+{
+    BuildArmaturePackage dataPackage;
+    if (!_fillBuildArmaturePackage(dataPackage, dragonBonesName, armatureName, "", ""))
+    {
+        return false;
+    }
+
+    std::map<std::size_t, unsigned> census;
+    _getObjectCensus(dataPackage, census);
+
+    for (const auto& pair : census)
+    {
+        BaseObject::prewarm(pair.first, pair.second * count);
+    }
+
+    return true;
+}
+
+AnimationBakeTask* BaseFactory::bakeAnimations(const std::string& dragonBonesName, const std::string& armatureName, unsigned frameRate)
+{
+    BuildArmaturePackage dataPackage;
+    if (!_fillBuildArmaturePackage(dataPackage, dragonBonesName, armatureName, "", ""))
+    {
+        DRAGONBONES_ASSERT(false, "No armature data. " + armatureName + ", " + (!dragonBonesName.empty() ? dragonBonesName : ""));
+        return nullptr;
+    }
+
+    for (const auto bakeTask : _bakeTasks)
+    {
+        if (bakeTask->getArmatureData() == dataPackage.armature)
+        {
+            return bakeTask;
+        }
+    }
+
+    // Allocate the caches and set the textures in the current thread, the baking thread only reads the data.
+    dataPackage.armature->cacheFrames(frameRate);
+
+    if (dataPackage.skin != nullptr)
+    {
+        for (const auto& pair : dataPackage.skin->displays)
+        {
+            for (const auto displayData : pair.second)
+            {
+                if (displayData == nullptr)
+                {
+                    continue;
+                }
+
+                if (displayData->type == DisplayType::Image)
+                {
+                    const auto imageDisplayData = static_cast<ImageDisplayData*>(displayData);
+                    if (imageDisplayData->texture == nullptr)
+                    {
+                        imageDisplayData->texture = _getTextureData(dataPackage.dataName, imageDisplayData->path);
+                    }
+                }
+                else if (displayData->type == DisplayType::Mesh)
+                {
+                    const auto meshDisplayData = static_cast<MeshDisplayData*>(displayData);
+                    if (meshDisplayData->texture == nullptr)
+                    {
+                        meshDisplayData->texture = _getTextureData(dataPackage.dataName, meshDisplayData->path);
+                    }
+                }
+            }
+        }
+    }
+
+    const auto bakeTask = new AnimationBakeTask(this, dataPackage.dataName, dataPackage.data, dataPackage.armature, _isSupportMesh());
+    _bakeTasks.push_back(bakeTask);
+
+    return bakeTask;
+}
+
+void BaseFactory::publishBakedAnimations()
+{
+    for (const auto bakeTask : _bakeTasks)
+    {
+        bakeTask->_publish();
+    }
+}
+
+bool BaseFactory::saveBakedAnimations(const std::string& dragonBonesName, const std::string& armatureName, const std::string& filePath) const
+{
+    BuildArmaturePackage dataPackage;
+    if (!_fillBuildArmaturePackage(dataPackage, dragonBonesName, armatureName, "", ""))
+    {
+        DRAGONBONES_ASSERT(false, "No armature data. " + armatureName + ", " + (!dragonBonesName.empty() ? dragonBonesName : ""));
+        return false;
+    }
+
+    return AnimationCacheFile::save(filePath, dataPackage.dataName, *dataPackage.data, *dataPackage.armature);
+}
+
+bool BaseFactory::loadBakedAnimations(const std::string& dragonBonesName, const std::string& armatureName, const std::string& filePath)
+{
+    BuildArmaturePackage dataPackage;
+    if (!_fillBuildArmaturePackage(dataPackage, dragonBonesName, armatureName, "", ""))
+    {
+        DRAGONBONES_ASSERT(false, "No armature data. " + armatureName + ", " + (!dragonBonesName.empty() ? dragonBonesName : ""));
+        return false;
+    }
+
+    for (std::size_t i = 0; i < _bakeTasks.size(); ++i)
+    {
+        const auto bakeTask = _bakeTasks[i];
+        if (bakeTask->getArmatureData() == dataPackage.armature)
+        {
+            delete bakeTask; // Stop baking, the baked caches would replace the loaded caches.
+            _bakeTasks.erase(_bakeTasks.begin() + i);
+            break;
+        }
+    }
+
+    const auto cacheFile = AnimationCacheFile::load(filePath, dataPackage.dataName, *dataPackage.data, *dataPackage.armature);
+    if (cacheFile == nullptr)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < _cacheFiles.size(); ++i)
+    {
+        const auto prevCacheFile = _cacheFiles[i];
+        if (prevCacheFile->getArmatureData() == dataPackage.armature)
+        {
+            delete prevCacheFile; // The animations have used the new file.
+            _cacheFiles.erase(_cacheFiles.begin() + i);
+            break;
+        }
+    }
+
+    _cacheFiles.push_back(cacheFile);
+
+    return true;
+}
+
 void BaseFactory::replaceSlotDisplay(const std::string& dragonBonesName, const std::string& armatureName, const std::string& slotName, const std::string& displayName, Slot* slot, int displayIndex) const
 {
     DRAGONBONES_ASSERT(slot, "");
@@ -8,6 +8,8 @@
 #include "../armature/Slot.h"
 #include "../armature/Constraint.h"
 #include "../animation/Animation.h"
+#include "AnimationBakeTask.h"
+#include "AnimationCacheFile.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 /**
@@ -44,9 +46,11 @@ public:
 */
 class BaseFactory
 {
+    friend class AnimationBakeTask;
+
 protected:
-    static JSONDataParser _jsonParser;
-    static BinaryDataParser _binaryParser;
+    static thread_local JSONDataParser _jsonParser;
+    static thread_local BinaryDataParser _binaryParser;
 
 public:
     /**
@@ -62,6 +66,8 @@ public:
 protected:
     std::map<std::string, DragonBonesData*> _dragonBonesDataMap;
     std::map<std::string, std::vector<TextureAtlasData*>> _textureAtlasDataMap;
+    std::vector<AnimationBakeTask*> _bakeTasks;
+    std::vector<AnimationCacheFile*> _cacheFiles;
     DragonBones* _dragonBones;
     DataParser* _dataParser;
 
@@ -76,10 +82,12 @@ public:
         autoSearch(false),
         _dragonBonesDataMap(),
         _textureAtlasDataMap(),
+        _bakeTasks(),
+        _cacheFiles(),
         _dragonBones(nullptr),
         _dataParser(nullptr)
     {
-        _dataParser = dataParser != nullptr ? dataParser : &BaseFactory::_jsonParser;
+        _dataParser = dataParser; // Default parsers are per thread, see _getDataParser().
     }
     virtual ~BaseFactory()
     {
@@ -90,6 +98,10 @@ public:
     }
 
 protected:
+    inline DataParser* _getDataParser() const
+    {
+        return _dataParser != nullptr ? _dataParser : &BaseFactory::_jsonParser;
+    }
     virtual bool _isSupportMesh() const
     {
         return true;
@@ -103,6 +115,14 @@ protected:
     virtual void _buildSlots(const BuildArmaturePackage& dataPackage, Armature& armature) const;
     virtual std::pair<void*, DisplayType> _getSlotDisplay(const BuildArmaturePackage* dataPackage, DisplayData& displayData, DisplayData* rawDisplayData, const Slot& slot) const;
     virtual void _replaceSlotDisplay(const BuildArmaturePackage& dataPackage, DisplayData* displayData, Slot& slot, int displayIndex) const;
+    virtual void _getObjectCensus(const BuildArmaturePackage& dataPackage, std::map<std::size_t, unsigned>& census) const;
+    /**
+    * 返回 _buildSlot() 创建的插槽的类型索引，用于预热对象池。
+    */
+    virtual std::size_t _getSlotClassTypeIndex() const
+    {
+        return 0;
+    }
 
     virtual TextureAtlasData* _buildTextureAtlasData(TextureAtlasData* textureAtlasData, void* textureAtlas) const = 0;
     virtual Armature* _buildArmature(const BuildArmaturePackage& dataPackage) const = 0;
@@ -215,6 +235,67 @@ public:
     */
     virtual Armature* buildArmature(const std::string& armatureName, const std::string& dragonBonesName = "", const std::string& skinName = "", const std::string & textureAtlasName = "") const;
     /**
+    * 预先创建骨架及其动画所需的对象并放入当前线程的对象池，以免批量创建骨架时分配内存。 (通常在加载数据后调用)
+    * 事件对象只计算开始播放时的淡入、开始和淡入完成事件，帧事件和声音事件不计算在内。
+    * @param armatureName 骨架数据名称。
+    * @param dragonBonesName 龙骨数据名称，如果未设置，将检索所有的龙骨数据。
+    * @param count 预计同时存在的骨架数量。
+    * @returns 是否找到骨架数据。
+    * @see dragonBones.BaseObject#prewarm()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual bool prewarm(const std::string& armatureName, const std::string& dragonBonesName = "", unsigned count = 1) const;
+    /**
+    * 在工作线程中烘焙骨架所有动画的帧缓存，避免第一次播放每个动画时计算缓存。 (通常在加载数据和贴图集数据后调用)
+    * 使用默认皮肤烘焙，子骨架不烘焙。 烘焙完成后由 publishBakedAnimations() 一次性发布所有动画的帧缓存，发布前的帧缓存照常在播放时计算。
+    * 烘焙时不能移除或修改该龙骨数据，移除龙骨数据会停止烘焙。
+    * @param dragonBonesName 龙骨数据名称，如果未设置，将检索所有的龙骨数据。
+    * @param armatureName 骨架数据名称。
+    * @param frameRate 缓存帧率。 (骨架数据已设置更高的缓存帧率时使用已设置的帧率)
+    * @returns 烘焙任务，用于查询进度，由工厂管理，移除龙骨数据时释放。 (没有找到骨架数据时为 nullptr)
+    * @see #publishBakedAnimations()
+    * @see dragonBones.Armature#setCacheFrameRate()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual AnimationBakeTask* bakeAnimations(const std::string& dragonBonesName, const std::string& armatureName, unsigned frameRate);
+    /**
+    * 发布已经烘焙完成的帧缓存，只能在更新线程调用。 (工厂的全局时钟更新前会自动调用)
+    * @see #bakeAnimations()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    void publishBakedAnimations();
+    /**
+    * 将骨架所有动画的帧缓存保存到文件，下次启动时通过 loadBakedAnimations() 加载，不需要再次烘焙。 (只能在更新线程调用)
+    * 所有动画需要已经缓存，通常在烘焙任务发布后调用。 只缓存了部分帧的插槽 (例如子骨架插槽) 不保存，加载后在播放时缓存。
+    * @param dragonBonesName 龙骨数据名称，如果未设置，将检索所有的龙骨数据。
+    * @param armatureName 骨架数据名称。
+    * @param filePath 文件路径。
+    * @returns 是否保存成功。
+    * @see #loadBakedAnimations()
+    * @see dragonBones.AnimationCacheFile
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    bool saveBakedAnimations(const std::string& dragonBonesName, const std::string& armatureName, const std::string& filePath) const;
+    /**
+    * 映射帧缓存文件，骨架所有动画直接使用映射的内存作为帧缓存。 (只能在更新线程调用)
+    * 文件的龙骨数据名称、骨架名称、动画、缓存帧率或源数据的内容哈希和当前数据不一致时不加载，可以重新烘焙并保存。
+    * 映射由工厂管理，移除龙骨数据时解除映射。 正在烘焙的同一个骨架会停止烘焙。
+    * 正在播放的该骨架数据的骨架在下一次更新时丢弃之前的缓存帧索引，改用文件中的帧缓存。
+    * @param dragonBonesName 龙骨数据名称，如果未设置，将检索所有的龙骨数据。
+    * @param armatureName 骨架数据名称。
+    * @param filePath 文件路径。
+    * @returns 是否加载成功。
+    * @see #saveBakedAnimations()
+    * @see dragonBones.AnimationCacheFile
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    bool loadBakedAnimations(const std::string& dragonBonesName, const std::string& armatureName, const std::string& filePath);
+    /**
     * 用指定资源替换指定插槽的显示对象。(用 "dragonBonesName/armatureName/slotName/displayName" 的资源替换 "slot" 的显示对象)
     * @param dragonBonesName 指定的龙骨数据名称。
     * @param armatureName 指定的骨架名称。
@@ -0,0 +1,99 @@
+#ifndef DRAGONBONES_MATRIX_BATCH_H
+#define DRAGONBONES_MATRIX_BATCH_H
+
+#include "../core/DragonBones.h"
+
+// SIMD kernels of the bone batch update, define DRAGONBONES_NO_SIMD to use the scalar kernels.
+#if !defined(DRAGONBONES_NO_SIMD)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define DRAGONBONES_SIMD_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DRAGONBONES_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * @private
+ * 批量计算矩阵。
+ * 矩阵的 2x2 部分按 a, b, c, d 连续存储，每个矩阵 4 个 float，位移单独存储。
+ * 与 Transform::toMatrix() 和 Matrix::concat() 的运算顺序相同，结果一致。 (除了 0 的符号，以及编译器对标量代码进行乘加融合时的舍入误差)
+ */
+class MatrixBatch final
+{
+public:
+    /**
+     * 将局部变换转换为矩阵。
+     * @param trigonometrics 每个矩阵的 cos(rotation), sin(rotation), -sin(skew + rotation), cos(skew + rotation)。
+     * @param result 矩阵，可以与 trigonometrics 相同。
+     */
+    static void toMatrices(std::size_t count, const float* trigonometrics, const float* scaleX, const float* scaleY, float* result)
+    {
+#if defined(DRAGONBONES_SIMD_SSE)
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto scale = _mm_set_ps(scaleY[i], scaleY[i], scaleX[i], scaleX[i]);
+            _mm_storeu_ps(result + i * 4, _mm_mul_ps(_mm_loadu_ps(trigonometrics + i * 4), scale));
+        }
+#elif defined(DRAGONBONES_SIMD_NEON)
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto scale = vcombine_f32(vdup_n_f32(scaleX[i]), vdup_n_f32(scaleY[i]));
+            vst1q_f32(result + i * 4, vmulq_f32(vld1q_f32(trigonometrics + i * 4), scale));
+        }
+#else
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto source = trigonometrics + i * 4;
+            const auto matrix = result + i * 4;
+            matrix[0] = source[0] * scaleX[i];
+            matrix[1] = source[1] * scaleX[i];
+            matrix[2] = source[2] * scaleY[i];
+            matrix[3] = source[3] * scaleY[i];
+        }
+#endif
+    }
+    /**
+     * 矩阵与父级矩阵相乘。 (同 Matrix::concat())
+     */
+    static inline void concat(
+        const float* matrix, float x, float y,
+        const float* parentMatrix, float parentX, float parentY,
+        float* result, float& resultX, float& resultY
+    )
+    {
+        resultX = parentMatrix[0] * x + parentMatrix[2] * y + parentX;
+        resultY = parentMatrix[3] * y + parentMatrix[1] * x + parentY;
+
+#if defined(DRAGONBONES_SIMD_SSE)
+        const auto m = _mm_loadu_ps(matrix);
+        const auto p = _mm_loadu_ps(parentMatrix);
+        const auto l1 = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 0, 0)); // aA, aA, cA, cA
+        const auto l2 = _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 3, 1, 1)); // bA, bA, dA, dA
+        const auto r1 = _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 0, 1, 0)); // aB, bB, aB, bB
+        const auto r2 = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 2, 3, 2)); // cB, dB, cB, dB
+        _mm_storeu_ps(result, _mm_add_ps(_mm_mul_ps(l1, r1), _mm_mul_ps(l2, r2)));
+#elif defined(DRAGONBONES_SIMD_NEON)
+        const auto m = vld1q_f32(matrix);
+        const auto p = vld1q_f32(parentMatrix);
+        const auto l = vtrnq_f32(m, m); // (aA, aA, cA, cA), (bA, bA, dA, dA)
+        const auto r1 = vcombine_f32(vget_low_f32(p), vget_low_f32(p)); // aB, bB, aB, bB
+        const auto r2 = vcombine_f32(vget_high_f32(p), vget_high_f32(p)); // cB, dB, cB, dB
+        vst1q_f32(result, vaddq_f32(vmulq_f32(l.val[0], r1), vmulq_f32(l.val[1], r2)));
+#else
+        const auto aA = matrix[0];
+        const auto bA = matrix[1];
+        const auto cA = matrix[2];
+        const auto dA = matrix[3];
+        result[0] = aA * parentMatrix[0] + bA * parentMatrix[2];
+        result[1] = aA * parentMatrix[1] + bA * parentMatrix[3];
+        result[2] = cA * parentMatrix[0] + dA * parentMatrix[2];
+        result[3] = cA * parentMatrix[1] + dA * parentMatrix[3];
+#endif
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_MATRIX_BATCH_H
@@ -3,6 +3,7 @@
 
 #include "../core/DragonBones.h"
 #include "Matrix.h"
+#include "Trigonometry.h"
 
 DRAGONBONES_NAMESPACE_BEGIN
 /**
@@ -143,8 +144,8 @@ public:
         rotation = std::atan(matrix.b / matrix.a);
         auto skewX = std::atan(-matrix.c / matrix.d);
 
-        scaleX = (rotation > -PI_Q && rotation < PI_Q) ? matrix.a / std::cos(rotation) : matrix.b / std::sin(rotation);
-        scaleY = (skewX > -PI_Q && skewX < PI_Q) ? matrix.d / std::cos(skewX) : -matrix.c / std::sin(skewX);
+        scaleX = (rotation > -PI_Q && rotation < PI_Q) ? matrix.a / Trigonometry::cos(rotation) : matrix.b / Trigonometry::sin(rotation);
+        scaleY = (skewX > -PI_Q && skewX < PI_Q) ? matrix.d / Trigonometry::cos(skewX) : -matrix.c / Trigonometry::sin(skewX);
 
         if (backupScaleX >= 0.0f && scaleX < 0.0f) 
         {
@@ -172,8 +173,7 @@ public:
     {
         if (skew != 0.0f || rotation != 0.0f) 
         {
-            matrix.a = std::cos(rotation);
-            matrix.b = std::sin(rotation);
+            Trigonometry::sinCos(rotation, matrix.b, matrix.a);
 
             if (skew == 0.0f) 
             {
@@ -182,8 +182,8 @@ public:
             }
             else 
             {
-                matrix.c = -std::sin(skew + rotation);
-                matrix.d = std::cos(skew + rotation);
+                Trigonometry::sinCos(skew + rotation, matrix.c, matrix.d);
+                matrix.c = -matrix.c;
             }
 
             if (scaleX != 1.0f) 
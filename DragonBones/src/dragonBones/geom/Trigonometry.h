@@ -0,0 +1,153 @@
+#ifndef DRAGONBONES_TRIGONOMETRY_H
+#define DRAGONBONES_TRIGONOMETRY_H
+
+#include "../core/DragonBones.h"
+
+// Trigonometry of the bone and slot transforms, choose one at build time.
+#define DRAGONBONES_TRIGONOMETRY_LIBM 0 // std::sin / std::cos.
+#define DRAGONBONES_TRIGONOMETRY_POLYNOMIAL 1 // Max error 1e-7 for |x| < 64 PI.
+#define DRAGONBONES_TRIGONOMETRY_TABLE 2 // Max error 2e-6 for |x| < 4 PI, grows with |x|.
+
+#ifndef DRAGONBONES_TRIGONOMETRY
+#define DRAGONBONES_TRIGONOMETRY DRAGONBONES_TRIGONOMETRY_LIBM
+#endif
+
+// Entry count of the sine table, power of 2.
+#ifndef DRAGONBONES_TRIGONOMETRY_TABLE_SIZE
+#define DRAGONBONES_TRIGONOMETRY_TABLE_SIZE 4096
+#endif
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+ * @private
+ * 三角函数，由 DRAGONBONES_TRIGONOMETRY 选择实现。
+ */
+class Trigonometry final
+{
+private:
+    static const float* _getSinTable()
+    {
+        static const struct SinTable
+        {
+            float values[DRAGONBONES_TRIGONOMETRY_TABLE_SIZE + 1];
+
+            SinTable()
+            {
+                for (std::size_t i = 0; i <= DRAGONBONES_TRIGONOMETRY_TABLE_SIZE; ++i)
+                {
+                    values[i] = (float)std::sin(i * 6.283185307179586 / DRAGONBONES_TRIGONOMETRY_TABLE_SIZE);
+                }
+            }
+        } table;
+
+        return table.values;
+    }
+
+    static inline float _tableSin(float x)
+    {
+        const auto table = _getSinTable();
+        const auto position = x * (DRAGONBONES_TRIGONOMETRY_TABLE_SIZE / 6.283185307f);
+        auto floorIndex = (int)position;
+        if ((float)floorIndex > position)
+        {
+            floorIndex--;
+        }
+
+        const auto floorPosition = (float)floorIndex;
+        const auto index = (unsigned)floorIndex & (DRAGONBONES_TRIGONOMETRY_TABLE_SIZE - 1);
+        const auto progress = position - floorPosition;
+
+        return table[index] + (table[index + 1] - table[index]) * progress;
+    }
+
+public:
+    /**
+     * 各个实现，用于比较精度和性能，运行时使用 sin(), cos() 和 sinCos()。
+     */
+    static inline void libmSinCos(float x, float& s, float& c)
+    {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+    static inline void polynomialSinCos(float x, float& s, float& c)
+    {
+        // Quadrant reduction, split PI / 2 to keep the remainder exact.
+        const auto position = x * 0.636619772f;
+        const auto quadrant = (int)(position >= 0.0f ? position + 0.5f : position - 0.5f);
+        const auto k = (float)quadrant;
+        auto r = x - k * 1.5703125f;
+        r -= k * 4.837512969970703125e-4f;
+        r -= k * 7.54978995489188216e-8f;
+
+        // Minimax polynomials on [-PI / 4, PI / 4].
+        const auto r2 = r * r;
+        const auto sr = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+        const auto cr = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+        switch (quadrant & 3)
+        {
+            case 0:
+                s = sr;
+                c = cr;
+                break;
+
+            case 1:
+                s = cr;
+                c = -sr;
+                break;
+
+            case 2:
+                s = -sr;
+                c = -cr;
+                break;
+
+            default:
+                s = -cr;
+                c = sr;
+                break;
+        }
+    }
+    static inline void tableSinCos(float x, float& s, float& c)
+    {
+        s = _tableSin(x);
+        c = _tableSin(x + 1.570796327f);
+    }
+
+    static inline float sin(float x)
+    {
+#if DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_POLYNOMIAL
+        float s, c;
+        polynomialSinCos(x, s, c);
+        return s;
+#elif DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_TABLE
+        return _tableSin(x);
+#else
+        return std::sin(x);
+#endif
+    }
+    static inline float cos(float x)
+    {
+#if DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_POLYNOMIAL
+        float s, c;
+        polynomialSinCos(x, s, c);
+        return c;
+#elif DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_TABLE
+        return _tableSin(x + 1.570796327f);
+#else
+        return std::cos(x);
+#endif
+    }
+    static inline void sinCos(float x, float& s, float& c)
+    {
+#if DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_POLYNOMIAL
+        polynomialSinCos(x, s, c);
+#elif DRAGONBONES_TRIGONOMETRY == DRAGONBONES_TRIGONOMETRY_TABLE
+        tableSinCos(x, s, c);
+#else
+        libmSinCos(x, s, c);
+#endif
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_TRIGONOMETRY_H
@@ -1,8 +1,208 @@
 #include "AnimationData.h"
 #include "ArmatureData.h"
+#include <cstring>
+#include <limits>
 
 DRAGONBONES_NAMESPACE_BEGIN
 
+std::atomic<unsigned> AnimationData::_cacheFrameGenerationCount(0);
+
+static const float FIXED_STEP_COUNT = 65535.0f;
+
+static uint16_t _floatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const auto sign = (uint16_t)((bits >> 16) & 0x8000);
+    const auto absBits = bits & 0x7FFFFFFF;
+    if (absBits >= 0x7F800000) // Infinity or NaN.
+    {
+        return sign | 0x7C00 | (absBits > 0x7F800000 ? 0x0200 : 0);
+    }
+
+    if (absBits >= 0x477FF000) // Rounds to infinity. (65520)
+    {
+        return sign | 0x7C00;
+    }
+
+    if (absBits < 0x38800000) // Subnormal or zero. (2^-14)
+    {
+        if (absBits < 0x33000000) // Rounds to zero. (2^-25)
+        {
+            return sign;
+        }
+
+        const auto mantissa = (absBits & 0x007FFFFF) | 0x00800000;
+        const auto shift = 126 - (absBits >> 23);
+        const auto remainder = mantissa & ((1u << shift) - 1);
+        const auto halfway = 1u << (shift - 1);
+        auto half = mantissa >> shift;
+        if (remainder > halfway || (remainder == halfway && (half & 1) != 0)) // Round to nearest even.
+        {
+            half++;
+        }
+
+        return sign | (uint16_t)half;
+    }
+
+    auto half = (absBits - 0x38000000) >> 13; // Rebias the exponent.
+    const auto remainder = absBits & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0)) // Round to nearest even, the carry goes to the exponent.
+    {
+        half++;
+    }
+
+    return sign | (uint16_t)half;
+}
+
+static float _halfToFloat(uint16_t value)
+{
+    const auto sign = (uint32_t)(value & 0x8000) << 16;
+    const auto exponent = (uint32_t)(value >> 10) & 0x1F;
+    auto mantissa = (uint32_t)value & 0x03FF;
+    uint32_t bits = 0;
+
+    if (exponent == 0x1F) // Infinity or NaN.
+    {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else if (exponent != 0)
+    {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    else if (mantissa != 0) // Subnormal, normalize it.
+    {
+        uint32_t floatExponent = 113;
+        while ((mantissa & 0x0400) == 0)
+        {
+            mantissa <<= 1;
+            floatExponent--;
+        }
+
+        bits = sign | (floatExponent << 23) | ((mantissa & 0x03FF) << 13);
+    }
+    else
+    {
+        bits = sign;
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+
+    return result;
+}
+
+static uint16_t _encodeValue(const AnimationData::CacheFrameEncoding& encoding, unsigned index, float value, bool& isClamped)
+{
+    if (encoding.format == CacheFrameFormat::Half)
+    {
+        return _floatToHalf(value);
+    }
+
+    const auto min = encoding.ranges[index * 2];
+    const auto step = encoding.ranges[index * 2 + 1];
+    if (step <= 0.0f) // All values are same.
+    {
+        isClamped = value != min;
+        return 0;
+    }
+
+    const auto quantized = std::round((value - min) / step);
+    if (!(quantized >= 0.0f)) // Also NaN.
+    {
+        isClamped = true;
+        return 0;
+    }
+
+    if (quantized > FIXED_STEP_COUNT)
+    {
+        isClamped = true;
+        return (uint16_t)FIXED_STEP_COUNT;
+    }
+
+    return (uint16_t)quantized;
+}
+
+static float _decodeValue(const AnimationData::CacheFrameEncoding& encoding, unsigned index, uint16_t value)
+{
+    if (encoding.format == CacheFrameFormat::Half)
+    {
+        return _halfToFloat(value);
+    }
+
+    return encoding.ranges[index * 2] + value * encoding.ranges[index * 2 + 1];
+}
+
+static uint64_t _getRecordHash(const char* record, std::size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a.
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= (unsigned char)record[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+template<class T>
+static void _deduplicateRecords(
+    std::vector<T>& frameData, unsigned cacheFrameCount, unsigned boneCount, const std::vector<bool>& cachedSlots, std::vector<int>& recordOffsets
+)
+{
+    const auto recordSize = AnimationData::CACHE_FRAME_SIZE;
+    const auto recordTotal = boneCount + (unsigned)cachedSlots.size();
+    std::unordered_multimap<uint64_t, unsigned> offsets;
+    unsigned recordCount = 0;
+
+    recordOffsets.assign(cacheFrameCount * recordTotal, -1);
+    for (unsigned i = 0; i < cacheFrameCount; ++i)
+    {
+        for (unsigned j = 0; j < recordTotal; ++j)
+        {
+            if (j >= boneCount && !cachedSlots[j - boneCount])
+            {
+                continue;
+            }
+
+            const auto record = frameData.data() + (i * recordTotal + j) * recordSize;
+            const auto hash = _getRecordHash((const char*)record, recordSize * sizeof(T));
+            const auto range = offsets.equal_range(hash);
+            auto recordOffset = -1;
+            for (auto iterator = range.first; iterator != range.second; ++iterator)
+            {
+                if (std::memcmp(frameData.data() + iterator->second, record, recordSize * sizeof(T)) == 0) // Bit-identical.
+                {
+                    recordOffset = (int)iterator->second;
+                    break;
+                }
+            }
+
+            if (recordOffset < 0) // Move forward, the unique records never overtake the frame records.
+            {
+                recordOffset = (int)(recordCount * recordSize);
+                std::copy_n(record, recordSize, frameData.data() + recordOffset);
+                offsets.emplace(hash, (unsigned)recordOffset);
+                recordCount++;
+            }
+
+            recordOffsets[i * recordTotal + j] = recordOffset;
+        }
+    }
+
+    frameData.resize(recordCount * recordSize);
+    frameData.shrink_to_fit();
+}
+
+void AnimationData::CacheFrameEncoding::clear()
+{
+    format = CacheFrameFormat::Float;
+    std::fill_n(ranges, CACHE_FRAME_SIZE * 2, 0.0f);
+    std::fill_n(errors, CACHE_FRAME_SIZE, 0.0f);
+    clampCount = 0;
+}
+
 void AnimationData::_onClear()
 {
     for (auto& pair : boneTimelines)
@@ -40,10 +240,23 @@ void AnimationData::_onClear()
     scale = 1.0f;
     fadeInTime = 0.0f;
     cacheFrameRate = 0.0f;
+    cacheFrameCount = 0;
+    cacheFrameRecordCount = 0;
+    cacheFrameReferenceCount = 0;
+    cacheFrameDeduplication = false;
+    cacheFrameGeneration = 0;
     name = "";
     cachedFrames.clear();
+    cacheFrameEncoding.clear();
+    cachedFrameData.clear();
+    compactFrameData.clear();
+    cachedFrameArray = nullptr;
+    compactFrameArray = nullptr;
+    cachedRecordOffsets.clear();
     boneTimelines.clear();
     slotTimelines.clear();
+    boneTimelinesByNameId.clear();
+    slotTimelinesByNameId.clear();
     boneCachedFrameIndices.clear();
     slotCachedFrameIndices.clear();
     parent = nullptr;
@@ -51,6 +264,19 @@ void AnimationData::_onClear()
     zOrderTimeline = nullptr;
 }
 
+void AnimationData::getCacheFrameInfo(unsigned frameRate, float& resultFrameRate, unsigned& resultFrameCount) const
+{
+    if (cacheFrameRate > 0.0f) // Cached.
+    {
+        resultFrameRate = cacheFrameRate;
+        resultFrameCount = cacheFrameCount;
+        return;
+    }
+
+    resultFrameRate = std::max(std::ceil(frameRate * scale), 1.0f);
+    resultFrameCount = (unsigned)std::ceil(resultFrameRate * duration) + 1; // Cache one more frame.
+}
+
 void AnimationData::cacheFrames(unsigned frameRate)
 {
     if (cacheFrameRate > 0.0f) // TODO clear cache.
@@ -58,10 +284,26 @@ void AnimationData::cacheFrames(unsigned frameRate)
         return;
     }
 
-    cacheFrameRate = std::max(std::ceil(frameRate * scale), 1.0f);
-    const auto cacheFrameCount = std::ceil(cacheFrameRate * duration) + 1; // Cache one more frame.
+    getCacheFrameInfo(frameRate, cacheFrameRate, cacheFrameCount);
+    cacheFrameGeneration = ++_cacheFrameGenerationCount;
 
     cachedFrames.resize(cacheFrameCount, false);
+    // Allocate the whole cache once, the records of a frame are stored in bone and slot order.
+    // Deduplicated records are appended when they are cached.
+    cacheFrameDeduplication = parent->cacheFrameDeduplication;
+    cacheFrameRecordCount = cacheFrameDeduplication ? 0 : (unsigned)(getCachedFrameDataSize() / CACHE_FRAME_SIZE);
+    cacheFrameEncoding.clear();
+    if (parent->cacheFrameFormat == CacheFrameFormat::Half)
+    {
+        cacheFrameEncoding.format = CacheFrameFormat::Half;
+        compactFrameData.resize(getCachedFrameValueCount(), 0);
+        compactFrameArray = compactFrameData.data();
+    }
+    else // Fixed needs the ranges of all frames, cache as float until the frames are baked.
+    {
+        cachedFrameData.resize(getCachedFrameValueCount(), 0.0f);
+        cachedFrameArray = cachedFrameData.data();
+    }
 
     for (const auto bone : parent->sortedBones)
     {
@@ -74,6 +316,449 @@ void AnimationData::cacheFrames(unsigned frameRate)
     }
 }
 
+unsigned AnimationData::setCacheFrame(const Matrix& globalTransformMatrix, const Transform& transform, unsigned arrayOffset)
+{
+    if (!cacheFrameDeduplication && cacheFrameEncoding.format == CacheFrameFormat::Float)
+    {
+        setCacheFrame(cachedFrameArray, globalTransformMatrix, transform, arrayOffset);
+        cacheFrameReferenceCount++;
+        return arrayOffset;
+    }
+
+    const float values[CACHE_FRAME_SIZE] = {
+        globalTransformMatrix.a, globalTransformMatrix.b, globalTransformMatrix.c, globalTransformMatrix.d,
+        globalTransformMatrix.tx, globalTransformMatrix.ty,
+        transform.rotation, transform.skew, transform.scaleX, transform.scaleY
+    };
+
+    if (cacheFrameDeduplication)
+    {
+        return _addCacheFrame(values);
+    }
+
+    _writeCacheFrame(arrayOffset, values);
+    cacheFrameReferenceCount++;
+
+    return arrayOffset;
+}
+
+void AnimationData::setCacheFrame(float* frameArray, const Matrix& globalTransformMatrix, const Transform& transform, unsigned arrayOffset) const
+{
+    const auto dataArray = frameArray + arrayOffset;
+    dataArray[0] = globalTransformMatrix.a;
+    dataArray[1] = globalTransformMatrix.b;
+    dataArray[2] = globalTransformMatrix.c;
+    dataArray[3] = globalTransformMatrix.d;
+    dataArray[4] = globalTransformMatrix.tx;
+    dataArray[5] = globalTransformMatrix.ty;
+    dataArray[6] = transform.rotation;
+    dataArray[7] = transform.skew;
+    dataArray[8] = transform.scaleX;
+    dataArray[9] = transform.scaleY;
+}
+
+void AnimationData::getCacheFrame(Matrix& globalTransformMatrix, Transform& transform, unsigned arrayOffset) const
+{
+    float values[CACHE_FRAME_SIZE];
+    const float* dataArray = nullptr;
+    if (cacheFrameEncoding.format == CacheFrameFormat::Float)
+    {
+        dataArray = cachedFrameArray + arrayOffset;
+    }
+    else
+    {
+        _readCacheFrame(arrayOffset, values);
+        dataArray = values;
+    }
+
+    globalTransformMatrix.a = dataArray[0];
+    globalTransformMatrix.b = dataArray[1];
+    globalTransformMatrix.c = dataArray[2];
+    globalTransformMatrix.d = dataArray[3];
+    globalTransformMatrix.tx = dataArray[4];
+    globalTransformMatrix.ty = dataArray[5];
+    transform.rotation = dataArray[6];
+    transform.skew = dataArray[7];
+    transform.scaleX = dataArray[8];
+    transform.scaleY = dataArray[9];
+    transform.x = globalTransformMatrix.tx;
+    transform.y = globalTransformMatrix.ty;
+}
+
+void AnimationData::_readCacheFrame(unsigned arrayOffset, float* values) const
+{
+    if (cacheFrameEncoding.format == CacheFrameFormat::Float)
+    {
+        std::copy_n(cachedFrameArray + arrayOffset, CACHE_FRAME_SIZE, values);
+        return;
+    }
+
+    const auto dataArray = compactFrameArray + arrayOffset;
+    for (unsigned i = 0; i < CACHE_FRAME_SIZE; ++i)
+    {
+        values[i] = _decodeValue(cacheFrameEncoding, i, dataArray[i]);
+    }
+}
+
+void AnimationData::_encodeCacheFrame(const float* values, uint16_t* dataArray)
+{
+    for (unsigned i = 0; i < CACHE_FRAME_SIZE; ++i)
+    {
+        auto isClamped = false;
+        dataArray[i] = _encodeValue(cacheFrameEncoding, i, values[i], isClamped);
+        if (isClamped)
+        {
+            cacheFrameEncoding.clampCount++;
+        }
+        else
+        {
+            const auto error = std::abs(_decodeValue(cacheFrameEncoding, i, dataArray[i]) - values[i]);
+            cacheFrameEncoding.errors[i] = std::max(cacheFrameEncoding.errors[i], error);
+        }
+    }
+}
+
+void AnimationData::_writeCacheFrame(unsigned arrayOffset, const float* values)
+{
+    if (cacheFrameEncoding.format == CacheFrameFormat::Float)
+    {
+        std::copy_n(values, CACHE_FRAME_SIZE, cachedFrameArray + arrayOffset);
+    }
+    else
+    {
+        _encodeCacheFrame(values, compactFrameArray + arrayOffset);
+    }
+}
+
+unsigned AnimationData::_addCacheFrame(const float* values)
+{
+    const auto isFloat = cacheFrameEncoding.format == CacheFrameFormat::Float;
+    const auto recordSize = CACHE_FRAME_SIZE * getCacheFrameValueSize();
+    uint16_t compactValues[CACHE_FRAME_SIZE];
+    const auto record = isFloat ? (const char*)values : (const char*)compactValues;
+    if (!isFloat)
+    {
+        _encodeCacheFrame(values, compactValues);
+    }
+
+    if (cachedRecordOffsets.size() < cacheFrameRecordCount) // Build the map once, loaded records have no map.
+    {
+        const auto frameBytes = getCachedFrameBytes();
+        cachedRecordOffsets.clear();
+        cachedRecordOffsets.reserve(cacheFrameRecordCount);
+        for (unsigned i = 0; i < cacheFrameRecordCount; ++i)
+        {
+            cachedRecordOffsets.emplace(_getRecordHash(frameBytes + i * recordSize, recordSize), i * CACHE_FRAME_SIZE);
+        }
+    }
+
+    cacheFrameReferenceCount++;
+
+    const auto hash = _getRecordHash(record, recordSize);
+    const auto range = cachedRecordOffsets.equal_range(hash);
+    for (auto iterator = range.first; iterator != range.second; ++iterator)
+    {
+        const auto arrayOffset = iterator->second;
+        if (std::memcmp(getCachedFrameBytes() + arrayOffset * getCacheFrameValueSize(), record, recordSize) == 0) // Bit-identical.
+        {
+            return arrayOffset;
+        }
+    }
+
+    copyCachedFrameData(); // The mapped memory can not grow.
+
+    const auto arrayOffset = cacheFrameRecordCount * CACHE_FRAME_SIZE;
+    if (isFloat)
+    {
+        cachedFrameData.insert(cachedFrameData.end(), values, values + CACHE_FRAME_SIZE);
+        cachedFrameArray = cachedFrameData.data();
+    }
+    else
+    {
+        compactFrameData.insert(compactFrameData.end(), compactValues, compactValues + CACHE_FRAME_SIZE);
+        compactFrameArray = compactFrameData.data();
+    }
+
+    cacheFrameRecordCount++;
+    cachedRecordOffsets.emplace(hash, arrayOffset);
+
+    return arrayOffset;
+}
+
+void AnimationData::_setCachedFrameArray(
+    const CacheFrameEncoding& encoding, float* frameArray, uint16_t* compactArray,
+    unsigned recordCount, const int* recordOffsets, const std::vector<bool>& cachedSlots
+)
+{
+    struct RuntimeRecord
+    {
+        std::vector<int>* indices;
+        unsigned cacheFrameIndex;
+        unsigned slotIndex;
+        float values[CACHE_FRAME_SIZE];
+    };
+
+    const auto boneCount = (unsigned)parent->sortedBones.size();
+    const auto recordTotal = boneCount + (unsigned)parent->sortedSlots.size();
+    const auto getRecordOffset = [&](unsigned cacheFrameIndex, unsigned recordIndex)
+    {
+        return recordOffsets != nullptr ? recordOffsets[cacheFrameIndex * recordTotal + recordIndex] : (int)getBoneCacheFrameOffset(cacheFrameIndex, recordIndex);
+    };
+
+    // Keep the frames which have been cached at runtime.
+    std::vector<RuntimeRecord> runtimeRecords;
+    unsigned referenceCount = 0;
+    for (const auto slot : parent->sortedSlots)
+    {
+        auto& indices = slotCachedFrameIndices[slot->name];
+        if (slot->index < cachedSlots.size() && cachedSlots[slot->index])
+        {
+            for (unsigned i = 0; i < cacheFrameCount; ++i)
+            {
+                indices[i] = getRecordOffset(i, boneCount + slot->index);
+            }
+
+            referenceCount += cacheFrameCount;
+        }
+        else
+        {
+            for (unsigned i = 0; i < cacheFrameCount; ++i)
+            {
+                if (indices[i] < 0) // Skip the frames which have not been cached, mapped pages are not touched.
+                {
+                    continue;
+                }
+
+                runtimeRecords.resize(runtimeRecords.size() + 1);
+                auto& runtimeRecord = runtimeRecords.back();
+                runtimeRecord.indices = &indices;
+                runtimeRecord.cacheFrameIndex = i;
+                runtimeRecord.slotIndex = slot->index;
+                _readCacheFrame(indices[i], runtimeRecord.values);
+            }
+        }
+    }
+
+    for (const auto bone : parent->sortedBones)
+    {
+        auto& indices = boneCachedFrameIndices[bone->name];
+        for (unsigned i = 0; i < cacheFrameCount; ++i)
+        {
+            indices[i] = getRecordOffset(i, bone->index);
+        }
+
+        referenceCount += cacheFrameCount;
+    }
+
+    cacheFrameEncoding = encoding;
+    cachedFrameArray = frameArray;
+    compactFrameArray = compactArray;
+    cacheFrameRecordCount = recordCount;
+    cacheFrameReferenceCount = referenceCount;
+    cacheFrameDeduplication = recordOffsets != nullptr;
+    cacheFrameGeneration = ++_cacheFrameGenerationCount; // Bones and slots of the running armatures hold offsets of the previous records.
+    cachedRecordOffsets.clear();
+
+    for (const auto& runtimeRecord : runtimeRecords)
+    {
+        auto& index = (*runtimeRecord.indices)[runtimeRecord.cacheFrameIndex];
+        if (cacheFrameDeduplication)
+        {
+            index = _addCacheFrame(runtimeRecord.values);
+        }
+        else
+        {
+            index = getSlotCacheFrameOffset(runtimeRecord.cacheFrameIndex, runtimeRecord.slotIndex);
+            _writeCacheFrame(index, runtimeRecord.values);
+            cacheFrameReferenceCount++;
+        }
+    }
+
+    std::fill(cachedFrames.begin(), cachedFrames.end(), true);
+}
+
+void AnimationData::setCachedFrameData(std::vector<float>& value, const std::vector<bool>& cachedSlots, const std::vector<int>* recordOffsets)
+{
+    const auto isValid = recordOffsets != nullptr ?
+        recordOffsets->size() == getCachedFrameDataSize() / CACHE_FRAME_SIZE && value.size() % CACHE_FRAME_SIZE == 0 :
+        value.size() == getCachedFrameDataSize();
+    if (!isValid)
+    {
+        DRAGONBONES_ASSERT(false, "Cache frame data size mismatch: " + name);
+        return;
+    }
+
+    // The buffers are moved, the previous records are still readable until the value is released.
+    cachedFrameData.swap(value);
+
+    CacheFrameEncoding encoding;
+    encoding.clear();
+    _setCachedFrameArray(
+        encoding, cachedFrameData.data(), nullptr,
+        (unsigned)(cachedFrameData.size() / CACHE_FRAME_SIZE), recordOffsets != nullptr ? recordOffsets->data() : nullptr, cachedSlots
+    );
+    std::vector<uint16_t>().swap(compactFrameData); // Release the memory.
+}
+
+void AnimationData::setCachedFrameData(std::vector<uint16_t>& value, const CacheFrameEncoding& encoding, const std::vector<bool>& cachedSlots, const std::vector<int>* recordOffsets)
+{
+    const auto isValid = recordOffsets != nullptr ?
+        recordOffsets->size() == getCachedFrameDataSize() / CACHE_FRAME_SIZE && value.size() % CACHE_FRAME_SIZE == 0 :
+        value.size() == getCachedFrameDataSize();
+    if (!isValid || encoding.format == CacheFrameFormat::Float)
+    {
+        DRAGONBONES_ASSERT(false, "Cache frame data size mismatch: " + name);
+        return;
+    }
+
+    if (encoding.format == CacheFrameFormat::Fixed && std::find(cachedSlots.cbegin(), cachedSlots.cend(), false) != cachedSlots.cend())
+    {
+        DRAGONBONES_ASSERT(false, "Fixed cache frame data can not be used with uncached slots: " + name);
+        return;
+    }
+
+    // The buffers are moved, the previous records are still readable until the value is released.
+    compactFrameData.swap(value);
+
+    _setCachedFrameArray(
+        encoding, nullptr, compactFrameData.data(),
+        (unsigned)(compactFrameData.size() / CACHE_FRAME_SIZE), recordOffsets != nullptr ? recordOffsets->data() : nullptr, cachedSlots
+    );
+    std::vector<float>().swap(cachedFrameData); // Release the memory.
+}
+
+void AnimationData::setCachedFrameData(void* value, const CacheFrameEncoding& encoding, unsigned recordCount, const int* recordOffsets, const std::vector<bool>& cachedSlots)
+{
+    if (encoding.format == CacheFrameFormat::Fixed && std::find(cachedSlots.cbegin(), cachedSlots.cend(), false) != cachedSlots.cend())
+    {
+        DRAGONBONES_ASSERT(false, "Fixed cache frame data can not be used with uncached slots: " + name);
+        return;
+    }
+
+    if (encoding.format == CacheFrameFormat::Float)
+    {
+        _setCachedFrameArray(encoding, (float*)value, nullptr, recordCount, recordOffsets, cachedSlots);
+    }
+    else
+    {
+        _setCachedFrameArray(encoding, nullptr, (uint16_t*)value, recordCount, recordOffsets, cachedSlots);
+    }
+
+    if (cachedFrameArray != cachedFrameData.data()) // Runtime records may have been appended to the owned memory.
+    {
+        std::vector<float>().swap(cachedFrameData);
+    }
+
+    if (compactFrameArray != compactFrameData.data())
+    {
+        std::vector<uint16_t>().swap(compactFrameData);
+    }
+}
+
+void AnimationData::copyCachedFrameData()
+{
+    if (cachedFrameArray != nullptr && cachedFrameArray != cachedFrameData.data())
+    {
+        cachedFrameData.assign(cachedFrameArray, cachedFrameArray + getCachedFrameValueCount());
+        cachedFrameArray = cachedFrameData.data();
+    }
+    else if (compactFrameArray != nullptr && compactFrameArray != compactFrameData.data())
+    {
+        compactFrameData.assign(compactFrameArray, compactFrameArray + getCachedFrameValueCount());
+        compactFrameArray = compactFrameData.data();
+    }
+}
+
+void AnimationData::encodeCachedFrameData(const std::vector<float>& frameData, const std::vector<bool>& cachedSlots, std::vector<uint16_t>& compactData, CacheFrameEncoding& encoding) const
+{
+    const auto format = encoding.format;
+    encoding.clear();
+    encoding.format = format;
+
+    const auto recordCount = (unsigned)(parent->sortedBones.size() + parent->sortedSlots.size());
+    const auto isCached = [&](unsigned recordIndex)
+    {
+        return recordIndex < parent->sortedBones.size() || cachedSlots[recordIndex - parent->sortedBones.size()];
+    };
+
+    if (format == CacheFrameFormat::Fixed)
+    {
+        float mins[CACHE_FRAME_SIZE];
+        float maxs[CACHE_FRAME_SIZE];
+        std::fill_n(mins, CACHE_FRAME_SIZE, std::numeric_limits<float>::max());
+        std::fill_n(maxs, CACHE_FRAME_SIZE, std::numeric_limits<float>::lowest());
+
+        for (unsigned i = 0; i < cacheFrameCount; ++i)
+        {
+            for (unsigned j = 0; j < recordCount; ++j)
+            {
+                if (!isCached(j))
+                {
+                    continue;
+                }
+
+                const auto dataArray = frameData.data() + getBoneCacheFrameOffset(i, j);
+                for (unsigned k = 0; k < CACHE_FRAME_SIZE; ++k)
+                {
+                    if (std::isfinite(dataArray[k]))
+                    {
+                        mins[k] = std::min(mins[k], dataArray[k]);
+                        maxs[k] = std::max(maxs[k], dataArray[k]);
+                    }
+                }
+            }
+        }
+
+        for (unsigned k = 0; k < CACHE_FRAME_SIZE; ++k)
+        {
+            if (mins[k] <= maxs[k])
+            {
+                encoding.ranges[k * 2] = mins[k];
+                encoding.ranges[k * 2 + 1] = (maxs[k] - mins[k]) / FIXED_STEP_COUNT;
+            }
+        }
+    }
+
+    compactData.assign(frameData.size(), 0);
+    for (unsigned i = 0; i < cacheFrameCount; ++i)
+    {
+        for (unsigned j = 0; j < recordCount; ++j)
+        {
+            if (!isCached(j))
+            {
+                continue;
+            }
+
+            const auto arrayOffset = getBoneCacheFrameOffset(i, j);
+            for (unsigned k = 0; k < CACHE_FRAME_SIZE; ++k)
+            {
+                const auto value = frameData[arrayOffset + k];
+                auto isClamped = false;
+                const auto encodedValue = _encodeValue(encoding, k, value, isClamped);
+                compactData[arrayOffset + k] = encodedValue;
+                if (isClamped)
+                {
+                    encoding.clampCount++;
+                }
+                else
+                {
+                    encoding.errors[k] = std::max(encoding.errors[k], std::abs(_decodeValue(encoding, k, encodedValue) - value));
+                }
+            }
+        }
+    }
+}
+
+void AnimationData::deduplicateCachedFrameData(std::vector<float>& frameData, const std::vector<bool>& cachedSlots, std::vector<int>& recordOffsets) const
+{
+    _deduplicateRecords(frameData, cacheFrameCount, (unsigned)parent->sortedBones.size(), cachedSlots, recordOffsets);
+}
+
+void AnimationData::deduplicateCachedFrameData(std::vector<uint16_t>& frameData, const std::vector<bool>& cachedSlots, std::vector<int>& recordOffsets) const
+{
+    _deduplicateRecords(frameData, cacheFrameCount, (unsigned)parent->sortedBones.size(), cachedSlots, recordOffsets);
+}
+
 void AnimationData::addBoneTimeline(BoneData* bone, TimelineData* value)
 {
     auto& timelines = boneTimelines[bone->name];
@@ -81,6 +766,13 @@ void AnimationData::addBoneTimeline(BoneData* bone, TimelineData* value)
     {
         timelines.push_back(value);
     }
+
+    if (bone->nameId >= boneTimelinesByNameId.size())
+    {
+        boneTimelinesByNameId.resize(bone->nameId + 1, nullptr);
+    }
+
+    boneTimelinesByNameId[bone->nameId] = &timelines; // Map values are never moved.
 }
 
 void AnimationData::addSlotTimeline(SlotData* slot, TimelineData* value)
@@ -90,6 +782,13 @@ void AnimationData::addSlotTimeline(SlotData* slot, TimelineData* value)
     {
         timelines.push_back(value);
     }
+
+    if (slot->nameId >= slotTimelinesByNameId.size())
+    {
+        slotTimelinesByNameId.resize(slot->nameId + 1, nullptr);
+    }
+
+    slotTimelinesByNameId[slot->nameId] = &timelines;
 }
 
 void TimelineData::_onClear()
@@ -13,6 +13,38 @@ class AnimationData : public BaseObject
 {
     BIND_CLASS_TYPE_B(AnimationData);
 
+public:
+    /**
+    * 每个缓存帧记录的数值个数。 (a, b, c, d, tx, ty, rotation, skew, scaleX, scaleY)
+    * @private
+    */
+    static const unsigned CACHE_FRAME_SIZE = 10;
+    /**
+    * 帧缓存的编码。
+    * @private
+    */
+    struct CacheFrameEncoding
+    {
+        /**
+        * 存储格式。
+        */
+        CacheFrameFormat format;
+        /**
+        * Fixed 格式每个数值的最小值和量化步长。 [min, step, min, step, ...]
+        */
+        float ranges[CACHE_FRAME_SIZE * 2];
+        /**
+        * 每个数值编码的最大绝对误差。
+        */
+        float errors[CACHE_FRAME_SIZE];
+        /**
+        * 超出 Fixed 范围被截断的数值个数。
+        */
+        unsigned clampCount;
+
+        void clear();
+    };
+
 public:
     /**
     * @private
@@ -59,6 +91,31 @@ public:
     */
     float cacheFrameRate;
     /**
+    * @private
+    */
+    unsigned cacheFrameCount;
+    /**
+    * 存储的缓存记录数。 (去重后为不同的记录数)
+    * @private
+    */
+    unsigned cacheFrameRecordCount;
+    /**
+    * 已缓存的记录数，去重时共享的记录分别计数。
+    * @private
+    */
+    unsigned cacheFrameReferenceCount;
+    /**
+    * 是否对帧缓存去重，去重时记录不再按帧排列，只能通过缓存帧索引访问。
+    * @see dragonBones.ArmatureData#cacheFrameDeduplication
+    * @private
+    */
+    bool cacheFrameDeduplication;
+    /**
+    * 帧缓存的版本，开始缓存和替换帧缓存时更新，骨骼和插槽的缓存帧索引只在版本相同时有效。
+    * @private
+    */
+    unsigned cacheFrameGeneration;
+    /**
     * 数据名称。
     * @version DragonBones 3.0
     * @language zh_CN
@@ -69,6 +126,38 @@ public:
     */
     std::vector<bool> cachedFrames;
     /**
+    * 正在使用的帧缓存编码和误差统计。
+    * @see dragonBones.ArmatureData#cacheFrameFormat
+    * @private
+    */
+    CacheFrameEncoding cacheFrameEncoding;
+    /**
+    * 缓存帧数据，[帧][骨骼, 插槽] 的连续内存，缓存帧率设置时一次分配。
+    * @private
+    */
+    std::vector<float> cachedFrameData;
+    /**
+    * 压缩的缓存帧数据，布局和 cachedFrameData 相同。
+    * @private
+    */
+    std::vector<uint16_t> compactFrameData;
+    /**
+    * 正在使用的缓存帧数据，指向 cachedFrameData 或帧缓存文件映射的内存。 (Float 格式)
+    * @see dragonBones.AnimationCacheFile
+    * @private
+    */
+    float* cachedFrameArray;
+    /**
+    * 正在使用的压缩缓存帧数据，指向 compactFrameData 或帧缓存文件映射的内存。 (Half 和 Fixed 格式)
+    * @private
+    */
+    uint16_t* compactFrameArray;
+    /**
+    * 去重时记录的内容哈希和偏移，需要时建立。
+    * @private
+    */
+    std::unordered_multimap<uint64_t, unsigned> cachedRecordOffsets;
+    /**
     * @private
     */
     std::map<std::string, std::vector<TimelineData*>> boneTimelines;
@@ -77,6 +166,18 @@ public:
     */
     std::map<std::string, std::vector<TimelineData*>> slotTimelines;
     /**
+    * 以骨骼名称标识为下标的骨骼时间轴。 (没有时间轴为 nullptr)
+    * @see dragonBones.BoneData#nameId
+    * @private
+    */
+    std::vector<std::vector<TimelineData*>*> boneTimelinesByNameId;
+    /**
+    * 以插槽名称标识为下标的插槽时间轴。 (没有时间轴为 nullptr)
+    * @see dragonBones.SlotData#nameId
+    * @private
+    */
+    std::vector<std::vector<TimelineData*>*> slotTimelinesByNameId;
+    /**
     * @private
     */
     std::map<std::string, std::vector<int>> boneCachedFrameIndices;
@@ -100,6 +201,8 @@ public:
     * @private
     */
     AnimationData() :
+        cachedFrameArray(nullptr),
+        compactFrameArray(nullptr),
         actionTimeline(nullptr),
         zOrderTimeline(nullptr)
     {
@@ -113,12 +216,146 @@ public:
 protected:
     virtual void _onClear() override;
 
+private:
+    static std::atomic<unsigned> _cacheFrameGenerationCount;
+
+    void _readCacheFrame(unsigned arrayOffset, float* values) const;
+    void _encodeCacheFrame(const float* values, uint16_t* dataArray);
+    void _writeCacheFrame(unsigned arrayOffset, const float* values);
+    unsigned _addCacheFrame(const float* values);
+    void _setCachedFrameArray(
+        const CacheFrameEncoding& encoding, float* frameArray, uint16_t* compactArray,
+        unsigned recordCount, const int* recordOffsets, const std::vector<bool>& cachedSlots
+    );
+
 public:
     /**
     * @private
     */
     void cacheFrames(unsigned frameRate);
     /**
+    * 以骨架的缓存帧率计算 cacheFrames() 之后的缓存帧率和缓存帧数，不修改数据。 (已经缓存时为当前的值)
+    * @private
+    */
+    void getCacheFrameInfo(unsigned frameRate, float& resultFrameRate, unsigned& resultFrameCount) const;
+    /**
+    * 缓存一个记录。
+    * @param arrayOffset 记录的位置，去重时不使用。
+    * @returns 记录的位置，去重时可能是已有的记录。
+    * @private
+    */
+    unsigned setCacheFrame(const Matrix& globalTransformMatrix, const Transform& transform, unsigned arrayOffset);
+    /**
+    * @private
+    */
+    void setCacheFrame(float* frameArray, const Matrix& globalTransformMatrix, const Transform& transform, unsigned arrayOffset) const;
+    /**
+    * @private
+    */
+    void getCacheFrame(Matrix& globalTransformMatrix, Transform& transform, unsigned arrayOffset) const;
+    /**
+    * 缓存帧数据的数值个数。
+    * @private
+    */
+    inline std::size_t getCachedFrameDataSize() const
+    {
+        return (std::size_t)cacheFrameCount * (parent->sortedBones.size() + parent->sortedSlots.size()) * CACHE_FRAME_SIZE;
+    }
+    /**
+    * 存储的缓存帧数据的数值个数。
+    * @private
+    */
+    inline std::size_t getCachedFrameValueCount() const
+    {
+        return (std::size_t)cacheFrameRecordCount * CACHE_FRAME_SIZE;
+    }
+    /**
+    * 缓存帧数据每个数值的字节数。
+    * @private
+    */
+    inline std::size_t getCacheFrameValueSize() const
+    {
+        return cacheFrameEncoding.format == CacheFrameFormat::Float ? sizeof(float) : sizeof(uint16_t);
+    }
+    /**
+    * 正在使用的缓存帧数据。
+    * @private
+    */
+    inline const char* getCachedFrameBytes() const
+    {
+        return cacheFrameEncoding.format == CacheFrameFormat::Float ? (const char*)cachedFrameArray : (const char*)compactFrameArray;
+    }
+    /**
+    * @private
+    */
+    inline unsigned getBoneCacheFrameOffset(unsigned cacheFrameIndex, unsigned boneIndex) const
+    {
+        return (cacheFrameIndex * (parent->sortedBones.size() + parent->sortedSlots.size()) + boneIndex) * CACHE_FRAME_SIZE;
+    }
+    /**
+    * @private
+    */
+    inline unsigned getSlotCacheFrameOffset(unsigned cacheFrameIndex, unsigned slotIndex) const
+    {
+        return getBoneCacheFrameOffset(cacheFrameIndex, parent->sortedBones.size() + slotIndex);
+    }
+    /**
+    * 替换为已经完整缓存的帧数据，所有的帧都标记为已缓存。 (只能在更新线程调用)
+    * @param value 帧数据，布局和 cachedFrameData 相同，替换后为原来的帧数据。
+    * @param cachedSlots 已缓存的插槽，以插槽索引为下标，未缓存的插槽在播放时缓存。
+    * @param recordOffsets 去重后每帧每个骨骼和插槽记录的位置，未缓存的插槽为 -1。 (没有去重时为 nullptr)
+    * @see #deduplicateCachedFrameData()
+    * @private
+    */
+    void setCachedFrameData(std::vector<float>& value, const std::vector<bool>& cachedSlots, const std::vector<int>* recordOffsets = nullptr);
+    /**
+    * 替换为已经完整缓存并压缩的帧数据，所有的帧都标记为已缓存。 (只能在更新线程调用)
+    * @param value 压缩的帧数据，替换后为原来的压缩帧数据。
+    * @param encoding 帧数据的编码，Fixed 编码时所有的插槽都需要已缓存。
+    * @param cachedSlots 已缓存的插槽，以插槽索引为下标，未缓存的插槽在播放时缓存。
+    * @param recordOffsets 去重后每帧每个骨骼和插槽记录的位置，未缓存的插槽为 -1。 (没有去重时为 nullptr)
+    * @see #encodeCachedFrameData()
+    * @private
+    */
+    void setCachedFrameData(std::vector<uint16_t>& value, const CacheFrameEncoding& encoding, const std::vector<bool>& cachedSlots, const std::vector<int>* recordOffsets = nullptr);
+    /**
+    * 使用外部内存中已经完整缓存的帧数据，外部内存需要可写，并在不再使用前调用 copyCachedFrameData()。 (只能在更新线程调用)
+    * @param value 帧数据，数值类型由编码格式决定。
+    * @param encoding 帧数据的编码，Fixed 编码时所有的插槽都需要已缓存。
+    * @param recordCount 帧数据的记录数。
+    * @param recordOffsets 去重后每帧每个骨骼和插槽记录的位置，未缓存的插槽为 -1。 (没有去重时为 nullptr，布局和 cachedFrameData 相同)
+    * @param cachedSlots 已缓存的插槽，以插槽索引为下标，未缓存的插槽在播放时缓存。
+    * @private
+    */
+    void setCachedFrameData(void* value, const CacheFrameEncoding& encoding, unsigned recordCount, const int* recordOffsets, const std::vector<bool>& cachedSlots);
+    /**
+    * 将正在使用的外部帧数据复制到 cachedFrameData 或 compactFrameData。
+    * @private
+    */
+    void copyCachedFrameData();
+    /**
+    * 压缩完整缓存的帧数据，只读取骨架数据，可以在工作线程调用。
+    * Fixed 格式的范围由所有骨骼和已缓存插槽的数值决定，未缓存的插槽在播放时缓存，超出范围的数值被截断。
+    * @param frameData 帧数据，布局和 cachedFrameData 相同。
+    * @param cachedSlots 已缓存的插槽，以插槽索引为下标。
+    * @param compactData 压缩的帧数据。
+    * @param encoding 需要设置存储格式 (Half 或 Fixed)，返回范围和误差。
+    * @private
+    */
+    void encodeCachedFrameData(const std::vector<float>& frameData, const std::vector<bool>& cachedSlots, std::vector<uint16_t>& compactData, CacheFrameEncoding& encoding) const;
+    /**
+    * 对完整缓存的帧数据去重，逐位相同的记录只保留第一个，只读取骨架数据，可以在工作线程调用。
+    * @param frameData 帧数据，布局和 cachedFrameData 相同，去重后只包含不同的记录。
+    * @param cachedSlots 已缓存的插槽，以插槽索引为下标，未缓存插槽的记录不保留。
+    * @param recordOffsets 每帧每个骨骼和插槽记录的位置，未缓存的插槽为 -1。
+    * @private
+    */
+    void deduplicateCachedFrameData(std::vector<float>& frameData, const std::vector<bool>& cachedSlots, std::vector<int>& recordOffsets) const;
+    /**
+    * @private
+    */
+    void deduplicateCachedFrameData(std::vector<uint16_t>& frameData, const std::vector<bool>& cachedSlots, std::vector<int>& recordOffsets) const;
+    /**
     * @private
     */
     void addBoneTimeline(BoneData* bone, TimelineData* value);
@@ -141,6 +378,22 @@ public:
         return mapFindB(slotTimelines, name);
     }
     /**
+    * 以名称标识获取骨骼时间轴，名称标识属于动画所在的龙骨数据。
+    * @private
+    */
+    inline std::vector<TimelineData*>* getBoneTimelinesByNameId(unsigned nameId) const
+    {
+        return nameId < boneTimelinesByNameId.size() ? boneTimelinesByNameId[nameId] : nullptr;
+    }
+    /**
+    * 以名称标识获取插槽时间轴，名称标识属于动画所在的龙骨数据。
+    * @private
+    */
+    inline std::vector<TimelineData*>* getSlotTimelineByNameId(unsigned nameId) const
+    {
+        return nameId < slotTimelinesByNameId.size() ? slotTimelinesByNameId[nameId] : nullptr;
+    }
+    /**
     * @private
     */
     inline std::vector<int>* getBoneCachedFrameIndices(const std::string& name)
@@ -47,6 +47,8 @@ void ArmatureData::_onClear()
     type = ArmatureType::Armature;
     frameRate = 0;
     cacheFrameRate = 0;
+    cacheFrameFormat = CacheFrameFormat::Float;
+    cacheFrameDeduplication = false;
     scale = 1.0f;
     name = "";
     aabb.clear();
@@ -71,48 +73,89 @@ void ArmatureData::sortBones()
         return;
     }
 
-    const auto sortHelper = sortedBones; // Copy.
-    unsigned index = 0;
-    unsigned count = 0;
-    sortedBones.clear();
-    while (count < total)
+    for (std::size_t i = 0; i < total; ++i)
     {
-        const auto bone = sortHelper[index++];
-        if (index >= total)
+        sortedBones[i]->index = i;
+    }
+
+    // Linear topological sort, the parent and the constraint targets of a bone are sorted before it.
+    std::vector<unsigned> dependencyCounts(total, 0);
+    std::vector<unsigned> dependentOffsets(total + 1, 0);
+    for (const auto bone : sortedBones)
+    {
+        if (bone->parent != nullptr)
         {
-            index = 0;
+            dependencyCounts[bone->index]++;
+            dependentOffsets[bone->parent->index + 1]++;
         }
 
-        if (std::find(sortedBones.cbegin(), sortedBones.cend(), bone) != sortedBones.cend())
+        for (const auto constraint : bone->constraints)
         {
-            continue;
+            dependencyCounts[bone->index]++;
+            dependentOffsets[constraint->target->index + 1]++;
         }
+    }
+
+    for (std::size_t i = 0; i < total; ++i)
+    {
+        dependentOffsets[i + 1] += dependentOffsets[i];
+    }
 
-        if(!bone->constraints.empty())
+    std::vector<unsigned> dependents(dependentOffsets[total]);
+    auto dependentCounts = dependentOffsets; // Copy.
+    for (const auto bone : sortedBones)
+    {
+        if (bone->parent != nullptr)
         {
-            auto flag = false;
-            for(const auto constrait : bone->constraints)
-            {
-                if(std::find(sortedBones.cbegin(), sortedBones.cend(), constrait->target) == sortedBones.cend())
-                {
-                    flag = true;
-                     break;
-                }
-            }
+            dependents[dependentCounts[bone->parent->index]++] = bone->index;
+        }
+
+        for (const auto constraint : bone->constraints)
+        {
+            dependents[dependentCounts[constraint->target->index]++] = bone->index;
+        }
+    }
+
+    std::vector<BoneData*> sortHelper;
+    sortHelper.reserve(total);
+    for (const auto bone : sortedBones)
+    {
+        if (dependencyCounts[bone->index] == 0)
+        {
+            sortHelper.push_back(bone);
+        }
+    }
 
-            if(flag)
+    for (std::size_t i = 0; i < sortHelper.size(); ++i)
+    {
+        const auto boneIndex = sortHelper[i]->index;
+        for (auto j = dependentOffsets[boneIndex], l = dependentOffsets[boneIndex + 1]; j < l; ++j)
+        {
+            const auto dependent = dependents[j];
+            if (--dependencyCounts[dependent] == 0)
             {
-                continue;
+                sortHelper.push_back(sortedBones[dependent]);
             }
         }
+    }
+
+    if (sortHelper.size() < total) // Data error.
+    {
+        DRAGONBONES_ASSERT(false, "Bone dependencies are circular: " + name);
 
-        if (bone->parent != nullptr && std::find(sortedBones.cbegin(), sortedBones.cend(), bone->parent) == sortedBones.cend())
+        for (const auto bone : sortedBones)
         {
-            continue;
+            if (dependencyCounts[bone->index] > 0)
+            {
+                sortHelper.push_back(bone);
+            }
         }
+    }
 
-        sortedBones.push_back(bone);
-        count++;
+    sortedBones.swap(sortHelper);
+    for (std::size_t i = 0; i < total; ++i)
+    {
+        sortedBones[i]->index = i;
     }
 }
 
@@ -130,41 +173,21 @@ void ArmatureData::cacheFrames(unsigned value)
     }
 }
 
-int ArmatureData::setCacheFrame(const Matrix& globalTransformMatrix, const Transform& transform)
+float ArmatureData::getCacheFrameDedupeRatio() const
 {
-    auto& dataArray = *&parent->cachedFrames;
-    auto arrayOffset = dataArray.size();
-
-    dataArray.resize(arrayOffset + 10);
-    dataArray[arrayOffset] = globalTransformMatrix.a;
-    dataArray[arrayOffset + 1] = globalTransformMatrix.b;
-    dataArray[arrayOffset + 2] = globalTransformMatrix.c;
-    dataArray[arrayOffset + 3] = globalTransformMatrix.d;
-    dataArray[arrayOffset + 4] = globalTransformMatrix.tx;
-    dataArray[arrayOffset + 5] = globalTransformMatrix.ty;
-    dataArray[arrayOffset + 6] = transform.rotation;
-    dataArray[arrayOffset + 7] = transform.skew;
-    dataArray[arrayOffset + 8] = transform.scaleX;
-    dataArray[arrayOffset + 9] = transform.scaleY;
-
-    return arrayOffset;
-}
+    std::size_t referenceCount = 0;
+    std::size_t recordCount = 0;
+    for (const auto& pair : animations)
+    {
+        const auto animationData = pair.second;
+        if (animationData->cacheFrameDeduplication)
+        {
+            referenceCount += animationData->cacheFrameReferenceCount;
+            recordCount += animationData->cacheFrameRecordCount;
+        }
+    }
 
-void ArmatureData::getCacheFrame(Matrix& globalTransformMatrix, Transform& transform, unsigned arrayOffset)
-{
-    auto& dataArray = *&parent->cachedFrames;
-    globalTransformMatrix.a = dataArray[arrayOffset];
-    globalTransformMatrix.b = dataArray[arrayOffset + 1];
-    globalTransformMatrix.c = dataArray[arrayOffset + 2];
-    globalTransformMatrix.d = dataArray[arrayOffset + 3];
-    globalTransformMatrix.tx = dataArray[arrayOffset + 4];
-    globalTransformMatrix.ty = dataArray[arrayOffset + 5];
-    transform.rotation = dataArray[arrayOffset + 6];
-    transform.skew = dataArray[arrayOffset + 7];
-    transform.scaleX = dataArray[arrayOffset + 8];
-    transform.scaleY = dataArray[arrayOffset + 9];
-    transform.x = globalTransformMatrix.tx;
-    transform.y = globalTransformMatrix.ty;
+    return recordCount > 0 ? (float)referenceCount / recordCount : 1.0f;
 }
 
 void ArmatureData::addBone(BoneData* value)
@@ -175,6 +198,7 @@ void ArmatureData::addBone(BoneData* value)
         bones[value->name]->returnToPool();
     }
 
+    value->index = sortedBones.size();
     bones[value->name] = value;
     sortedBones.push_back(value);
 }
@@ -187,6 +211,7 @@ void ArmatureData::addSlot(SlotData* value)
         slots[value->name]->returnToPool();
     }
 
+    value->index = sortedSlots.size();
     slots[value->name] = value;
     sortedSlots.push_back(value);
 }
@@ -240,6 +265,8 @@ void BoneData::_onClear()
     inheritScale = false;
     inheritReflection = false;
     length = 0.0f;
+    index = 0;
+    nameId = 0;
     name = "";
     transform.identity();
     constraints.clear();
@@ -265,12 +292,15 @@ void SlotData::_onClear()
         delete color;
     }
 
+    color = nullptr;
+
     blendMode = BlendMode::Normal;
     displayIndex = 0;
     zOrder = 0;
+    index = 0;
+    nameId = 0;
     name = "";
     parent = nullptr;
-    color = nullptr;
     userData = nullptr;
 }
 
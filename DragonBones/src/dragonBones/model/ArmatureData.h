@@ -33,6 +33,28 @@ public:
     */
     unsigned cacheFrameRate;
     /**
+    * 帧缓存的存储格式，需要在缓存帧率设置前设置。
+    * Float: 每个数值 4 字节，没有误差。
+    * Half: 每个数值 2 字节的半精度浮点数，播放时缓存也会压缩，相对误差约 1/2048，位移 1024 ~ 2048 像素时误差最大 0.5 像素。
+    * Fixed: 每个数值 2 字节，以每个动画每个数值的范围定点量化，误差为范围的 1/131070，只在烘焙发布或加载帧缓存文件后压缩，之前以 Float 缓存。
+    * 有插槽不能烘焙时 (子骨架或没有显示对象的插槽在播放时缓存) Fixed 以 Float 发布。
+    * @default dragonBones.CacheFrameFormat.Float
+    * @see dragonBones.BaseFactory#bakeAnimations()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    CacheFrameFormat cacheFrameFormat;
+    /**
+    * 是否对帧缓存去重，需要在缓存帧率设置前设置。
+    * 开启后每个缓存的记录以内容哈希查找，和已有记录逐位相同时共享已有记录，只存储不同的记录。 (静止或重复的骨骼和插槽只存储一次)
+    * 播放时缓存需要计算哈希，烘焙的帧缓存在工作线程中去重。
+    * @default false
+    * @see #getCacheFrameDedupeRatio()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    bool cacheFrameDeduplication;
+    /**
     * @private
     */
     float scale;
@@ -147,14 +169,6 @@ public:
     /**
     * @private
     */
-    int setCacheFrame(const Matrix& globalTransformMatrix, const Transform& transform);
-    /**
-    * @private
-    */
-    void getCacheFrame(Matrix& globalTransformMatrix, Transform& transform, unsigned arrayOffset);
-    /**
-    * @private
-    */
     void addBone(BoneData* value);
     /**
     * @private
@@ -212,6 +226,13 @@ public:
     {
         return mapFind(animations, name);
     }
+    /**
+    * 帧缓存的去重比例，所有动画已缓存的记录数除以存储的记录数。 (没有开启去重时为 1)
+    * @see #cacheFrameDeduplication
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    float getCacheFrameDedupeRatio() const;
 
 public: // For WebAssembly.
     Rectangle getAABB() const { return aabb; }
@@ -259,6 +280,14 @@ public:
     */
     float length;
     /**
+    * @private
+    */
+    unsigned index;
+    /**
+    * @private
+    */
+    unsigned nameId;
+    /**
     * 数据名称。
     * @version DragonBones 3.0
     * @language zh_CN
@@ -341,6 +370,14 @@ public:
     */
     int zOrder;
     /**
+    * @private
+    */
+    unsigned index;
+    /**
+    * @private
+    */
+    unsigned nameId;
+    /**
     * 数据名称。
     * @version DragonBones 3.0
     * @language zh_CN
@@ -6,29 +6,38 @@ DRAGONBONES_NAMESPACE_BEGIN
 
 void DragonBonesData::_onClear()
 {
-    for (const auto& pair : armatures)
+    if (arena != nullptr) // Armature data was created in the arena, destroy it at once.
     {
-        pair.second->returnToPool();
+        delete arena;
     }
-
-    if (buffer != nullptr)
+    else
     {
-        delete buffer;
+        for (const auto& pair : armatures)
+        {
+            pair.second->returnToPool();
+        }
+
+        if (userData != nullptr)
+        {
+            userData->returnToPool();
+        }
     }
 
-    if (userData != nullptr)
+    if (buffer != nullptr)
     {
-        userData->returnToPool();
+        delete buffer;
     }
 
     autoSearch = false;
     frameRate = 0;
     version = "";
     name = "";
+    contentHash = 0;
     frameIndices.clear();
-    cachedFrames.clear();
     armatureNames.clear();
     armatures.clear();
+    names.clear();
+    nameIds.clear();
     buffer = nullptr;
     intArray = nullptr;
     floatArray = nullptr;
@@ -37,6 +46,7 @@ void DragonBonesData::_onClear()
     frameArray = nullptr;
     timelineArray = nullptr;
     userData = nullptr;
+    arena = nullptr;
 
     // TODO 需要释放 buffer
     // TODO lsc JS call delete
@@ -55,6 +65,21 @@ void DragonBonesData::addArmature(ArmatureData* value)
     armatureNames.push_back(value->name);
 }
 
+unsigned DragonBonesData::addName(const std::string& name)
+{
+    const auto iterator = nameIds.find(name);
+    if (iterator != nameIds.cend())
+    {
+        return iterator->second;
+    }
+
+    const unsigned nameId = names.size();
+    names.push_back(name);
+    nameIds[name] = nameId;
+
+    return nameId;
+}
+
 // For WebAssembly.
 DragonBonesData* DragonBonesData::_dragonBoneData = nullptr;
 
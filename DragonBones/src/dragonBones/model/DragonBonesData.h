@@ -43,13 +43,15 @@ public:
     */
     std::string name;
     /**
+    * 源数据的内容哈希，用于校验帧缓存文件。 [0: 未知]
+    * @see dragonBones.AnimationCacheFile
     * @private
     */
-    std::vector<unsigned> frameIndices;
+    uint64_t contentHash;
     /**
     * @private
     */
-    std::vector<float> cachedFrames;
+    std::vector<unsigned> frameIndices;
     /**
     * 所有骨架数据名称。
     * @see #armatures
@@ -67,6 +69,14 @@ public:
     /**
     * @private
     */
+    std::vector<std::string> names;
+    /**
+    * @private
+    */
+    std::unordered_map<std::string, unsigned> nameIds;
+    /**
+    * @private
+    */
     char* buffer;
     /**
     * @private
@@ -99,9 +109,14 @@ public:
     /**
     * @private
     */
+    ObjectArena* arena;
+    /**
+    * @private
+    */
     DragonBonesData() :
         buffer(nullptr),
-        userData(nullptr)
+        userData(nullptr),
+        arena(nullptr)
     {
         _onClear();
     }
@@ -114,6 +129,24 @@ public:
     */
     void addArmature(ArmatureData* value);
     /**
+    * @private
+    */
+    unsigned addName(const std::string& name);
+    /**
+    * 获取名称在龙骨数据中的唯一标识，骨骼、插槽和动画的名称在解析时获得标识，可以通过标识快速查找骨骼和插槽。
+    * @param name 名称。
+    * @returns 标识，名称不存在时返回 -1。
+    * @see dragonBones.Armature#getBoneByNameId()
+    * @see dragonBones.Armature#getSlotByNameId()
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline int getNameId(const std::string& name) const
+    {
+        const auto iterator = nameIds.find(name);
+        return iterator != nameIds.cend() ? (int)iterator->second : -1;
+    }
+    /**
     * 获取骨架数据。
     * @param name 骨架数据名称。
     * @see dragonBones.ArmatureData
@@ -16,7 +16,20 @@ DRAGONBONES_NAMESPACE_BEGIN
  */
 class DataParser
 {
-    ABSTRACT_CLASS(DataParser)
+public:
+    /**
+     * 是否将解析出的数据创建在龙骨数据独有的内存区中，龙骨数据销毁时一次性释放所有数据，而不返还对象池。
+     * @see dragonBones.ObjectArena
+     * @see dragonBones.DragonBonesData#arena
+     * @version DragonBones 5.1
+     * @language zh_CN
+     */
+    bool arenaEnabled;
+
+    DataParser() :
+        arenaEnabled(false)
+    {}
+    virtual ~DataParser() {}
 
 protected:
     static const char* DATA_VERSION_2_3;
@@ -297,6 +297,7 @@ BoneData* JSONDataParser::_parseBone(const rapidjson::Value& rawData)
     bone->inheritReflection = _getBoolean(rawData, INHERIT_REFLECTION, true);
     bone->length = _getNumber(rawData, LENGTH, 0.0f) * _armature->scale;
     bone->name = _getString(rawData, NAME, "");
+    bone->nameId = _data->addName(bone->name);
 
     if (rawData.HasMember(TRANSFORM))
     {
@@ -342,6 +343,7 @@ SlotData* JSONDataParser::_parseSlot(const rapidjson::Value& rawData)
     slot->displayIndex = _getNumber(rawData, DISPLAY_INDEX, (int)0);
     slot->zOrder = _armature->sortedSlots.size();
     slot->name = _getString(rawData, NAME, "");
+    slot->nameId = _data->addName(slot->name);
     slot->parent = _armature->getBone(_getString(rawData, PARENT, ""));
 
     if (rawData.HasMember(BLEND_MODE) && rawData[BLEND_MODE].IsString())
@@ -1580,6 +1582,13 @@ DragonBonesData* JSONDataParser::_parseDragonBonesData(const rapidjson::Value& r
 
         if (rawData.HasMember(ARMATURE))
         {
+            ObjectArena* prevArena = nullptr;
+            if (arenaEnabled)
+            {
+                data->arena = new ObjectArena();
+                prevArena = BaseObject::setArena(data->arena);
+            }
+
             _data = data;
 
             _parseArray(rawData);
@@ -1641,6 +1650,11 @@ DragonBonesData* JSONDataParser::_parseDragonBonesData(const rapidjson::Value& r
 
             _data = nullptr;
             _defalultColorOffset = -1;
+
+            if (arenaEnabled)
+            {
+                BaseObject::setArena(prevArena);
+            }
         }
 
         _rawTextureAtlasIndex = 0;
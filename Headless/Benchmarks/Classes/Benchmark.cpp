@@ -0,0 +1,731 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <thread>
+#include "dragonBones/geom/MatrixBatch.h"
+
+static const float FRAME_TIME = 1.0f / 60.0f;
+static const unsigned CACHE_FRAME_RATE = 24;
+static const unsigned BONES_PER_CASE = 20000; // Keep the total bone count of each advanceTime case similar.
+static const unsigned MAX_ARMATURE_COUNT = 200;
+static const unsigned BUILD_BATCH_COUNT = 16;
+static const unsigned CLOCK_CHURN_COUNT = 10000; // Registered armatures.
+static const unsigned CLOCK_CHURN_BATCH_COUNT = 1000; // Removed and added back between two ticks.
+static const char* RUNTIME_VERSION = "5.1.0";
+static const unsigned MATRIX_BATCH_HIERARCHY_COUNT = 200;
+static const unsigned MATRIX_BATCH_BONE_COUNT = 120;
+static const float MATRIX_BATCH_EPSILON = 1e-5f; // Relative, the scalar reference may be fused by the compiler.
+static const unsigned TRIGONOMETRY_SAMPLE_COUNT = 1 << 20;
+static const unsigned TRIGONOMETRY_BATCH_COUNT = 4096;
+static volatile float _trigonometrySink = 0.0f; // Keeps the measured calls.
+
+template<void (*SinCos)(float, float&, float&)>
+static double _getTrigonometryError(float range)
+{
+    auto maxError = 0.0;
+    for (unsigned i = 0; i <= TRIGONOMETRY_SAMPLE_COUNT; ++i)
+    {
+        const auto x = -range + 2.0f * range * i / TRIGONOMETRY_SAMPLE_COUNT;
+        float s, c;
+        SinCos(x, s, c);
+        maxError = std::max(maxError, std::max(std::abs(s - std::sin((double)x)), std::abs(c - std::cos((double)x))));
+    }
+
+    return maxError;
+}
+
+template<void (*SinCos)(float, float&, float&)>
+static double _getTrigonometryTime(const std::vector<float>& inputs, double minTime)
+{
+    std::size_t callCount = 0;
+    const auto start = std::chrono::steady_clock::now();
+    auto time = 0.0;
+    do
+    {
+        auto sum = 0.0f;
+        for (const auto x : inputs)
+        {
+            float s, c;
+            SinCos(x, s, c);
+            sum += s + c;
+        }
+
+        _trigonometrySink = sum;
+        callCount += inputs.size();
+        time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (time < minTime);
+
+    return time / callCount;
+}
+
+Benchmark::Benchmark() :
+    minTime(0.5f),
+    checksPassed(true),
+    _factory(dragonBones::HeadlessFactory::getFactory())
+{
+}
+
+double Benchmark::_getSeconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void Benchmark::_getPoolCounts(unsigned& borrowCount, unsigned& allocationCount)
+{
+    std::vector<dragonBones::BaseObject::PoolStats> poolStats;
+    dragonBones::BaseObject::getPoolStats(poolStats);
+
+    borrowCount = 0;
+    allocationCount = 0;
+    for (const auto& stats : poolStats)
+    {
+        borrowCount += stats.borrowHitCount + stats.borrowMissCount;
+        allocationCount += stats.borrowMissCount;
+    }
+}
+
+std::vector<dragonBones::Armature*> Benchmark::_buildArmatures(const SyntheticSkeleton& skeleton, unsigned count) const
+{
+    std::vector<dragonBones::Armature*> armatures;
+    for (unsigned i = 0; i < count; ++i)
+    {
+        const auto armature = _factory->buildArmature(skeleton.name, skeleton.name);
+        if (armature != nullptr)
+        {
+            armatures.push_back(armature);
+        }
+    }
+
+    return armatures;
+}
+
+void Benchmark::_disposeArmatures(std::vector<dragonBones::Armature*>& armatures) const
+{
+    for (const auto armature : armatures)
+    {
+        armature->dispose();
+    }
+
+    armatures.clear();
+    dragonBones::HeadlessFactory::advanceTime(0.0f); // Return disposed objects to the pools.
+}
+
+float Benchmark::_getRandom(unsigned& random, float min, float max)
+{
+    random = random * 1664525u + 1013904223u;
+    return min + (max - min) * (float)(random >> 8) / 16777216.0f;
+}
+
+bool Benchmark::_checkMatrixBatch(std::ostringstream& result)
+{
+#if defined(DRAGONBONES_SIMD_SSE)
+    const auto kernel = "sse";
+#elif defined(DRAGONBONES_SIMD_NEON)
+    const auto kernel = "neon";
+#else
+    const auto kernel = "scalar";
+#endif
+
+    // Random hierarchies, the kernels against Transform::toMatrix() and Matrix::concat().
+    const auto count = MATRIX_BATCH_BONE_COUNT;
+    std::vector<unsigned> parentIndices(count);
+    std::vector<dragonBones::Transform> transforms(count);
+    std::vector<dragonBones::Matrix> references(count);
+    std::vector<float> localMatrices(count * 4), worldMatrices(count * 4), scaleX(count), scaleY(count), tx(count), ty(count);
+    unsigned random = 1;
+    unsigned identicalCount = 0;
+    auto maxMatrixError = 0.0f;
+    auto maxTranslationError = 0.0f;
+    const auto getError = [](float value, float reference)
+    {
+        return std::abs(value - reference) / std::max(1.0f, std::abs(reference));
+    };
+
+    for (unsigned i = 0; i < MATRIX_BATCH_HIERARCHY_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < count; ++j)
+        {
+            auto& transform = transforms[j];
+            parentIndices[j] = j > 0 ? (unsigned)_getRandom(random, 0.0f, (float)j) : 0;
+            transform.x = _getRandom(random, -100.0f, 100.0f);
+            transform.y = _getRandom(random, -100.0f, 100.0f);
+            transform.rotation = j % 8 == 0 ? 0.0f : _getRandom(random, -6.3f, 6.3f); // Also the branches of Transform::toMatrix().
+            transform.skew = j % 3 == 0 ? 0.0f : _getRandom(random, -0.5f, 0.5f);
+            transform.scaleX = j % 5 == 0 ? 1.0f : _getRandom(random, -2.0f, 2.0f);
+            transform.scaleY = j % 7 == 0 ? 1.0f : _getRandom(random, -2.0f, 2.0f);
+
+            // Reference.
+            auto& reference = references[j];
+            transform.toMatrix(reference);
+            if (j > 0)
+            {
+                reference.concat(references[parentIndices[j]]);
+            }
+
+            // Kernels, the same steps as PoseBuffer::updateWorldMatrices().
+            const auto trigonometrics = localMatrices.data() + j * 4;
+            if (transform.skew != 0.0f || transform.rotation != 0.0f)
+            {
+                dragonBones::Trigonometry::sinCos(transform.rotation, trigonometrics[1], trigonometrics[0]);
+                if (transform.skew == 0.0f)
+                {
+                    trigonometrics[2] = -trigonometrics[1];
+                    trigonometrics[3] = trigonometrics[0];
+                }
+                else
+                {
+                    dragonBones::Trigonometry::sinCos(transform.skew + transform.rotation, trigonometrics[2], trigonometrics[3]);
+                    trigonometrics[2] = -trigonometrics[2];
+                }
+            }
+            else
+            {
+                trigonometrics[0] = 1.0f;
+                trigonometrics[1] = 0.0f;
+                trigonometrics[2] = 0.0f;
+                trigonometrics[3] = 1.0f;
+            }
+
+            scaleX[j] = transform.scaleX;
+            scaleY[j] = transform.scaleY;
+        }
+
+        dragonBones::MatrixBatch::toMatrices(count, localMatrices.data(), scaleX.data(), scaleY.data(), localMatrices.data());
+        std::copy_n(localMatrices.data(), 4, worldMatrices.data()); // The root has no parent.
+        tx[0] = transforms[0].x;
+        ty[0] = transforms[0].y;
+
+        for (unsigned j = 1; j < count; ++j)
+        {
+            const auto parentIndex = parentIndices[j];
+            dragonBones::MatrixBatch::concat(
+                localMatrices.data() + j * 4, transforms[j].x, transforms[j].y,
+                worldMatrices.data() + parentIndex * 4, tx[parentIndex], ty[parentIndex],
+                worldMatrices.data() + j * 4, tx[j], ty[j]
+            );
+        }
+
+        for (unsigned j = 0; j < count; ++j)
+        {
+            const auto& reference = references[j];
+            const auto matrix = worldMatrices.data() + j * 4;
+            const float values[] = { reference.a, reference.b, reference.c, reference.d };
+            auto isIdentical = tx[j] == reference.tx && ty[j] == reference.ty;
+            for (unsigned k = 0; k < 4; ++k)
+            {
+                isIdentical = isIdentical && matrix[k] == values[k];
+                maxMatrixError = std::max(maxMatrixError, getError(matrix[k], values[k]));
+            }
+
+            // The translation adds the parent translation, relative to the larger one for the cancellation.
+            const auto& parentReference = references[parentIndices[j]];
+            const auto translation = std::max(
+                std::max(std::abs(reference.tx), std::abs(reference.ty)),
+                std::max(std::abs(parentReference.tx), std::abs(parentReference.ty))
+            );
+            maxTranslationError = std::max(maxTranslationError, std::max(std::abs(tx[j] - reference.tx), std::abs(ty[j] - reference.ty)) / std::max(1.0f, translation));
+            if (isIdentical)
+            {
+                identicalCount++;
+            }
+        }
+    }
+
+    const auto isPassed = maxMatrixError <= MATRIX_BATCH_EPSILON && maxTranslationError <= MATRIX_BATCH_EPSILON;
+
+    result << "\"matrixBatch\":{";
+    result << "\"kernel\":\"" << kernel << "\",";
+    result << "\"matrices\":" << MATRIX_BATCH_HIERARCHY_COUNT * count << ",";
+    result << "\"identicalMatrices\":" << identicalCount << ",";
+    result << "\"maxRelativeErrors\":{";
+    result << "\"matrix\":" << maxMatrixError << ",";
+    result << "\"translation\":" << maxTranslationError;
+    result << "},";
+    result << "\"epsilon\":" << MATRIX_BATCH_EPSILON << ",";
+    result << "\"passed\":" << (isPassed ? "true" : "false");
+    result << "}";
+
+    return isPassed;
+}
+
+void Benchmark::_benchmarkTrigonometry(std::ostringstream& result) const
+{
+    static const char* POLICY_NAMES[] = { "libm", "polynomial", "table" };
+
+    // Bone rotations and skews, in [-2 PI, 2 PI].
+    std::vector<float> inputs(TRIGONOMETRY_BATCH_COUNT);
+    unsigned random = 1;
+    for (auto& x : inputs)
+    {
+        x = _getRandom(random, -6.283185307f, 6.283185307f);
+    }
+
+    const double maxErrors[][2] = {
+        { _getTrigonometryError<dragonBones::Trigonometry::libmSinCos>(4.0f * dragonBones::Transform::PI), _getTrigonometryError<dragonBones::Trigonometry::libmSinCos>(64.0f * dragonBones::Transform::PI) },
+        { _getTrigonometryError<dragonBones::Trigonometry::polynomialSinCos>(4.0f * dragonBones::Transform::PI), _getTrigonometryError<dragonBones::Trigonometry::polynomialSinCos>(64.0f * dragonBones::Transform::PI) },
+        { _getTrigonometryError<dragonBones::Trigonometry::tableSinCos>(4.0f * dragonBones::Transform::PI), _getTrigonometryError<dragonBones::Trigonometry::tableSinCos>(64.0f * dragonBones::Transform::PI) }
+    };
+    const double times[] = {
+        _getTrigonometryTime<dragonBones::Trigonometry::libmSinCos>(inputs, minTime),
+        _getTrigonometryTime<dragonBones::Trigonometry::polynomialSinCos>(inputs, minTime),
+        _getTrigonometryTime<dragonBones::Trigonometry::tableSinCos>(inputs, minTime)
+    };
+
+    result << "\"trigonometry\":{";
+    result << "\"policy\":\"" << POLICY_NAMES[DRAGONBONES_TRIGONOMETRY] << "\",";
+    result << "\"policies\":[";
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        result << (i > 0 ? "," : "") << "{";
+        result << "\"name\":\"" << POLICY_NAMES[i] << "\",";
+        result << "\"maxErrorTo4Pi\":" << maxErrors[i][0] << ",";
+        result << "\"maxErrorTo64Pi\":" << maxErrors[i][1] << ",";
+        result << "\"nanosecondsPerSinCos\":" << times[i] * 1000000000.0;
+        result << "}";
+    }
+
+    result << "]";
+    result << "}";
+}
+
+void Benchmark::_benchmarkClockChurn(std::ostringstream& result) const
+{
+    const SyntheticSkeleton skeleton("clock_churn", 10, 40, 1);
+    _factory->parseDragonBonesData(skeleton.createDragonBonesData().c_str(), skeleton.name);
+    _factory->parseTextureAtlasData(skeleton.createTextureAtlasData().c_str(), nullptr, skeleton.name);
+    auto armatures = _buildArmatures(skeleton, CLOCK_CHURN_COUNT);
+    const auto count = (unsigned)armatures.size();
+
+    dragonBones::WorldClock clock;
+    auto start = Clock::now();
+    for (const auto armature : armatures)
+    {
+        clock.add(armature);
+    }
+
+    const auto addTime = _getSeconds(start);
+
+    start = Clock::now();
+    unsigned containsCount = 0;
+    for (const auto armature : armatures)
+    {
+        if (clock.contains(armature))
+        {
+            containsCount++;
+        }
+    }
+
+    const auto containsTime = _getSeconds(start);
+
+    // Remove and add back a batch of armatures spread over the clock between the ticks.
+    unsigned random = 1;
+    unsigned operationCount = 0;
+    unsigned tickCount = 0;
+    auto operationTime = 0.0;
+    auto tickTime = 0.0;
+    std::vector<dragonBones::Armature*> batch;
+    do
+    {
+        batch.clear();
+        for (unsigned i = 0; i < CLOCK_CHURN_BATCH_COUNT && i < count; ++i)
+        {
+            random = random * 1664525u + 1013904223u;
+            batch.push_back(armatures[(random >> 8) % count]);
+        }
+
+        start = Clock::now();
+        for (const auto armature : batch)
+        {
+            clock.remove(armature);
+        }
+
+        operationTime += _getSeconds(start);
+
+        start = Clock::now();
+        clock.advanceTime(FRAME_TIME);
+        tickTime += _getSeconds(start);
+
+        start = Clock::now();
+        for (const auto armature : batch)
+        {
+            clock.add(armature);
+        }
+
+        operationTime += _getSeconds(start);
+        operationCount += (unsigned)batch.size() * 2;
+
+        start = Clock::now();
+        clock.advanceTime(FRAME_TIME);
+        tickTime += _getSeconds(start);
+        tickCount += 2;
+    } while (operationTime + tickTime < minTime);
+
+    start = Clock::now();
+    for (const auto armature : armatures)
+    {
+        clock.remove(armature);
+    }
+
+    const auto removeTime = _getSeconds(start);
+
+    _disposeArmatures(armatures);
+    _factory->removeDragonBonesData(skeleton.name);
+    _factory->removeTextureAtlasData(skeleton.name);
+
+    result << "\"clockChurn\":{";
+    result << "\"armatures\":" << count << ",";
+    result << "\"nanosecondsPerAdd\":" << addTime * 1000000000.0 / std::max(count, 1u) << ",";
+    result << "\"nanosecondsPerContains\":" << containsTime * 1000000000.0 / std::max(count, 1u) << ",";
+    result << "\"nanosecondsPerRemove\":" << removeTime * 1000000000.0 / std::max(count, 1u) << ",";
+    result << "\"contained\":" << containsCount << ",";
+    result << "\"churnOperations\":" << operationCount << ",";
+    result << "\"nanosecondsPerChurnOperation\":" << operationTime * 1000000000.0 / std::max(operationCount, 1u) << ",";
+    result << "\"ticks\":" << tickCount << ",";
+    result << "\"millisecondsPerTick\":" << tickTime * 1000.0 / std::max(tickCount, 1u);
+    result << "}";
+}
+
+double Benchmark::_measureTickTime(std::vector<dragonBones::Armature*>& armatures, unsigned& frameCount) const
+{
+    dragonBones::WorldClock clock;
+    for (const auto armature : armatures)
+    {
+        clock.add(armature);
+    }
+
+    for (unsigned i = 0; i < 60; ++i) // Warm up, a whole loop builds the frame cache.
+    {
+        clock.advanceTime(FRAME_TIME);
+    }
+
+    frameCount = 0;
+    const auto start = Clock::now();
+    auto time = 0.0;
+    do
+    {
+        for (unsigned i = 0; i < 10; ++i)
+        {
+            clock.advanceTime(FRAME_TIME);
+        }
+
+        frameCount += 10;
+        time = _getSeconds(start);
+    } while (time < minTime);
+
+    clock.clear();
+    dragonBones::HeadlessFactory::advanceTime(0.0f);
+
+    return time / frameCount;
+}
+
+void Benchmark::_benchmarkParse(const SyntheticSkeleton& skeleton, const std::string& rawData, std::ostringstream& result) const
+{
+    const auto name = skeleton.name + "_parse";
+    unsigned borrowCount = 0, allocationCount = 0;
+    unsigned prevBorrowCount = 0, prevAllocationCount = 0;
+    unsigned iterationCount = 0;
+
+    _factory->parseDragonBonesData(rawData.c_str(), name); // Warm up the pools.
+    _factory->removeDragonBonesData(name);
+
+    _getPoolCounts(prevBorrowCount, prevAllocationCount);
+    const auto start = Clock::now();
+    auto time = 0.0;
+    do
+    {
+        _factory->parseDragonBonesData(rawData.c_str(), name);
+        _factory->removeDragonBonesData(name);
+        iterationCount++;
+        time = _getSeconds(start);
+    } while (time < minTime);
+
+    _getPoolCounts(borrowCount, allocationCount);
+
+    result << "\"parse\":{";
+    result << "\"bytes\":" << rawData.size() << ",";
+    result << "\"iterations\":" << iterationCount << ",";
+    result << "\"millisecondsPerParse\":" << time * 1000.0 / iterationCount << ",";
+    result << "\"megabytesPerSecond\":" << rawData.size() * iterationCount / time / (1024.0 * 1024.0) << ",";
+    result << "\"poolBorrowsPerParse\":" << (double)(borrowCount - prevBorrowCount) / iterationCount << ",";
+    result << "\"poolAllocations\":" << allocationCount - prevAllocationCount;
+    result << "}";
+}
+
+void Benchmark::_benchmarkBuild(const SyntheticSkeleton& skeleton, std::ostringstream& result) const
+{
+    unsigned borrowCount = 0, allocationCount = 0;
+    unsigned prevBorrowCount = 0, prevAllocationCount = 0;
+    unsigned iterationCount = 0;
+    auto time = 0.0;
+
+    auto armatures = _buildArmatures(skeleton, BUILD_BATCH_COUNT); // Warm up the pools.
+    _disposeArmatures(armatures);
+
+    _getPoolCounts(prevBorrowCount, prevAllocationCount);
+    do
+    {
+        const auto start = Clock::now(); // Disposing is not measured.
+        armatures = _buildArmatures(skeleton, BUILD_BATCH_COUNT);
+        time += _getSeconds(start);
+        iterationCount += BUILD_BATCH_COUNT;
+        _disposeArmatures(armatures);
+    } while (time < minTime);
+
+    _getPoolCounts(borrowCount, allocationCount);
+
+    result << "\"build\":{";
+    result << "\"iterations\":" << iterationCount << ",";
+    result << "\"microsecondsPerBuild\":" << time * 1000000.0 / iterationCount << ",";
+    result << "\"poolBorrowsPerBuild\":" << (double)(borrowCount - prevBorrowCount) / iterationCount << ",";
+    result << "\"poolAllocations\":" << allocationCount - prevAllocationCount;
+    result << "}";
+}
+
+void Benchmark::_benchmarkAdvanceTime(const SyntheticSkeleton& skeleton, bool cacheEnabled, unsigned stateCount, std::ostringstream& result) const
+{
+    const auto armatureCount = std::min(MAX_ARMATURE_COUNT, std::max(1u, BONES_PER_CASE / skeleton.boneCount));
+    auto armatures = _buildArmatures(skeleton, armatureCount);
+    for (const auto armature : armatures)
+    {
+        if (cacheEnabled)
+        {
+            armature->setCacheFrameRate(CACHE_FRAME_RATE);
+        }
+
+        for (unsigned i = 0; i < stateCount; ++i) // Same layer with equal weights, so every state is blended.
+        {
+            const auto animationName = skeleton.getAnimationName(i % skeleton.animationCount);
+            const auto animationState = armature->getAnimation()->fadeIn(
+                animationName, 0.0f, 0, 0, animationName + std::to_string(i), dragonBones::AnimationFadeOutMode::None
+            );
+            animationState->weight = 1.0f / stateCount;
+        }
+    }
+
+    unsigned frameCount = 0;
+    const auto frameTime = _measureTickTime(armatures, frameCount);
+    _disposeArmatures(armatures);
+
+    result << "{";
+    result << "\"cache\":" << (cacheEnabled ? "true" : "false") << ",";
+    result << "\"states\":" << stateCount << ",";
+    result << "\"armatures\":" << armatureCount << ",";
+    result << "\"frames\":" << frameCount << ",";
+    result << "\"microsecondsPerArmature\":" << frameTime * 1000000.0 / armatureCount << ",";
+    result << "\"nanosecondsPerBone\":" << frameTime * 1000000000.0 / armatureCount / skeleton.boneCount;
+    result << "}";
+}
+
+void Benchmark::_benchmarkCacheFormat(const SyntheticSkeleton& skeleton, const std::string& rawData, dragonBones::CacheFrameFormat format, bool deduplication, std::ostringstream& result) const
+{
+    static const char* FORMAT_NAMES[] = { "float", "half", "fixed" };
+
+    // The frame cache of parsed data can not be cleared, so every format uses its own copy of the data.
+    const auto formatName = FORMAT_NAMES[(unsigned)format];
+    const auto name = skeleton.name + "_" + formatName + (deduplication ? "_dedupe" : "");
+    _factory->parseDragonBonesData(rawData.c_str(), name);
+    const auto armatureData = _factory->getArmatureData(skeleton.name, name);
+    armatureData->cacheFrameFormat = format;
+    armatureData->cacheFrameDeduplication = deduplication;
+
+    const auto bakeStart = Clock::now();
+    const auto bakeTask = _factory->bakeAnimations(name, skeleton.name, CACHE_FRAME_RATE);
+    while (!bakeTask->isCompleted())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    _factory->publishBakedAnimations();
+    const auto bakeTime = _getSeconds(bakeStart);
+
+    std::size_t cacheBytes = 0;
+    float errors[dragonBones::AnimationData::CACHE_FRAME_SIZE] = {};
+    unsigned clampCount = 0;
+    for (const auto& pair : armatureData->animations)
+    {
+        const auto animationData = pair.second;
+        const auto& encoding = animationData->cacheFrameEncoding;
+        cacheBytes += animationData->getCachedFrameValueCount() * animationData->getCacheFrameValueSize();
+        clampCount += encoding.clampCount;
+        for (unsigned i = 0; i < dragonBones::AnimationData::CACHE_FRAME_SIZE; ++i)
+        {
+            errors[i] = std::max(errors[i], encoding.errors[i]);
+        }
+    }
+
+    const auto armatureCount = std::min(MAX_ARMATURE_COUNT, std::max(1u, BONES_PER_CASE / skeleton.boneCount));
+    std::vector<dragonBones::Armature*> armatures;
+    for (unsigned i = 0; i < armatureCount; ++i)
+    {
+        const auto armature = _factory->buildArmature(skeleton.name, name, "", skeleton.name);
+        armature->setCacheFrameRate(CACHE_FRAME_RATE);
+        armature->getAnimation()->play(skeleton.getAnimationName(i % skeleton.animationCount), 0);
+        armatures.push_back(armature);
+    }
+
+    unsigned frameCount = 0;
+    const auto frameTime = _measureTickTime(armatures, frameCount);
+    const auto dedupeRatio = armatureData->getCacheFrameDedupeRatio();
+    _disposeArmatures(armatures);
+    _factory->removeDragonBonesData(name);
+
+    result << "{";
+    result << "\"format\":\"" << formatName << "\",";
+    result << "\"deduplication\":" << (deduplication ? "true" : "false") << ",";
+    result << "\"dedupeRatio\":" << dedupeRatio << ",";
+    result << "\"bakeMilliseconds\":" << bakeTime * 1000.0 << ",";
+    result << "\"cacheBytes\":" << cacheBytes << ",";
+    result << "\"armatures\":" << armatureCount << ",";
+    result << "\"frames\":" << frameCount << ",";
+    result << "\"microsecondsPerArmature\":" << frameTime * 1000000.0 / armatureCount << ",";
+    result << "\"nanosecondsPerBone\":" << frameTime * 1000000000.0 / armatureCount / skeleton.boneCount << ",";
+    result << "\"maxErrors\":{";
+    result << "\"matrix\":" << *std::max_element(errors, errors + 4) << ",";
+    result << "\"translation\":" << std::max(errors[4], errors[5]) << ",";
+    result << "\"rotationSkew\":" << std::max(errors[6], errors[7]) << ",";
+    result << "\"scale\":" << std::max(errors[8], errors[9]);
+    result << "},";
+    result << "\"clampedValues\":" << clampCount;
+    result << "}";
+}
+
+void Benchmark::_benchmarkSkinning(const SyntheticSkeleton& skeleton, std::ostringstream& result) const
+{
+    // The mesh is skinned only when it is displayed, the difference between the two runs is the skinning cost.
+    const auto armatureCount = std::min(MAX_ARMATURE_COUNT, std::max(1u, BONES_PER_CASE / skeleton.boneCount));
+    double frameTimes[2];
+    unsigned frameCount = 0;
+
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        auto armatures = _buildArmatures(skeleton, armatureCount);
+        for (const auto armature : armatures)
+        {
+            armature->getAnimation()->play(skeleton.getAnimationName(0), 0);
+            if (i > 0)
+            {
+                armature->getSlot(skeleton.getMeshSlotName())->setDisplayIndex(-1);
+            }
+        }
+
+        frameTimes[i] = _measureTickTime(armatures, frameCount);
+        _disposeArmatures(armatures);
+    }
+
+    const auto vertexCount = (double)armatureCount * skeleton.meshVertexCount;
+
+    result << "\"skinning\":{";
+    result << "\"vertices\":" << skeleton.meshVertexCount << ",";
+    result << "\"armatures\":" << armatureCount << ",";
+    result << "\"nanosecondsPerVertex\":" << std::max(0.0, frameTimes[0] - frameTimes[1]) * 1000000000.0 / vertexCount;
+    result << "}";
+}
+
+void Benchmark::_benchmarkContainsPoint(const SyntheticSkeleton& skeleton, std::ostringstream& result) const
+{
+    auto armatures = _buildArmatures(skeleton, 1);
+    const auto armature = armatures[0];
+    armature->getAnimation()->play(skeleton.getAnimationName(0), 0);
+    armature->advanceTime(0.25f);
+
+    const auto& aabb = armature->armatureData->aabb;
+    unsigned random = 1;
+    unsigned queryCount = 0;
+    unsigned hitCount = 0;
+    const auto start = Clock::now();
+    auto time = 0.0;
+    do
+    {
+        for (unsigned i = 0; i < 100; ++i)
+        {
+            random = random * 1664525u + 1013904223u; // Deterministic points inside the AABB.
+            const auto x = aabb.x + aabb.width * (float)(random >> 16) / 65536.0f;
+            random = random * 1664525u + 1013904223u;
+            const auto y = aabb.y + aabb.height * (float)(random >> 16) / 65536.0f;
+            if (armature->containsPoint(x, y) != nullptr)
+            {
+                hitCount++;
+            }
+        }
+
+        queryCount += 100;
+        time = _getSeconds(start);
+    } while (time < minTime);
+
+    _disposeArmatures(armatures);
+
+    result << "\"containsPoint\":{";
+    result << "\"boundingBoxes\":" << skeleton.getBoundingBoxCount() << ",";
+    result << "\"queries\":" << queryCount << ",";
+    result << "\"queriesPerSecond\":" << queryCount / time << ",";
+    result << "\"hitRatio\":" << (double)hitCount / queryCount;
+    result << "}";
+}
+
+std::string Benchmark::run(const std::vector<unsigned>& boneCounts)
+{
+    std::ostringstream result;
+    result << "{\"version\":\"" << RUNTIME_VERSION << "\",\"minTime\":" << minTime << ",";
+
+    checksPassed = _checkMatrixBatch(result);
+    result << ",";
+    _benchmarkTrigonometry(result);
+    result << ",\"results\":[";
+
+    for (std::size_t i = 0, l = boneCounts.size(); i < l; ++i)
+    {
+        const auto boneCount = boneCounts[i];
+        const SyntheticSkeleton skeleton("bones_" + std::to_string(boneCount), boneCount, boneCount * 4, 4);
+        const auto rawData = skeleton.createDragonBonesData();
+        const auto rawTextureAtlasData = skeleton.createTextureAtlasData();
+
+        result << (i > 0 ? "," : "") << "{";
+        result << "\"bones\":" << skeleton.boneCount << ",";
+        result << "\"slots\":" << skeleton.getSlotCount() << ",";
+        result << "\"meshVertices\":" << skeleton.meshVertexCount << ",";
+
+        _benchmarkParse(skeleton, rawData, result);
+        result << ",";
+
+        _factory->parseDragonBonesData(rawData.c_str(), skeleton.name);
+        _factory->parseTextureAtlasData(rawTextureAtlasData.c_str(), nullptr, skeleton.name);
+
+        _benchmarkBuild(skeleton, result);
+        result << ",\"advanceTime\":[";
+
+        // The frame cache can not be disabled once the data is cached, so measure everything without cache first.
+        std::ostringstream extraResult;
+        for (unsigned j = 0, stateCount = 1; j < 3; ++j, stateCount *= 2)
+        {
+            result << (j > 0 ? "," : "");
+            _benchmarkAdvanceTime(skeleton, false, stateCount, result);
+        }
+
+        _benchmarkSkinning(skeleton, extraResult);
+        extraResult << ",";
+        _benchmarkContainsPoint(skeleton, extraResult);
+
+        for (unsigned j = 0, stateCount = 1; j < 3; ++j, stateCount *= 2)
+        {
+            result << ",";
+            _benchmarkAdvanceTime(skeleton, true, stateCount, result);
+        }
+
+        result << "],\"cacheFormat\":[";
+        for (unsigned j = 0; j < 6; ++j)
+        {
+            result << (j > 0 ? "," : "");
+            _benchmarkCacheFormat(skeleton, rawData, (dragonBones::CacheFrameFormat)(j % 3), j >= 3, result);
+        }
+
+        result << "]," << extraResult.str() << "}";
+
+        _factory->removeDragonBonesData(skeleton.name);
+        _factory->removeTextureAtlasData(skeleton.name);
+    }
+
+    result << "],";
+    _benchmarkClockChurn(result);
+    result << "}";
+
+    return result.str();
+}
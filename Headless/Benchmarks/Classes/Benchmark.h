@@ -0,0 +1,61 @@
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <chrono>
+#include <sstream>
+#include "dragonBones/headless/HeadlessDragonBonesHeaders.h"
+#include "SyntheticSkeleton.h"
+
+/**
+ * Measures the core runtime on the headless backend and writes the results as JSON for regression tracking.
+ * - parse: JSON parsing throughput and pooled objects borrowed per parse.
+ * - build: buildArmature() latency.
+ * - advanceTime: WorldClock::advanceTime() cost per armature, with frame cache off / on and 1 / 2 / 4 blended animation states.
+ * - cacheFormat: frame cache memory, decode cost and encoding error of each frame cache format, with and without record deduplication.
+ * - skinning: cost per skinned mesh vertex.
+ * - containsPoint: Armature::containsPoint() throughput.
+ * - matrixBatch: the SIMD (or scalar) bone matrix kernels against Transform::toMatrix() and Matrix::concat().
+ * - clockChurn: WorldClock add / contains / remove at 10k registered armatures, with ticks between the batches.
+ * - trigonometry: maximum error against double precision libm and cost of each Trigonometry policy.
+ */
+class Benchmark
+{
+public:
+    /**
+     * Minimum measured time of each case, in seconds.
+     */
+    float minTime;
+    /**
+     * Whether the kernels matched their scalar references in the last run.
+     */
+    bool checksPassed;
+
+    Benchmark();
+
+    std::string run(const std::vector<unsigned>& boneCounts);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    dragonBones::HeadlessFactory* _factory;
+
+    static double _getSeconds(const Clock::time_point& start);
+    static void _getPoolCounts(unsigned& borrowCount, unsigned& allocationCount);
+    static float _getRandom(unsigned& random, float min, float max);
+    static bool _checkMatrixBatch(std::ostringstream& result);
+
+    std::vector<dragonBones::Armature*> _buildArmatures(const SyntheticSkeleton& skeleton, unsigned count) const;
+    void _disposeArmatures(std::vector<dragonBones::Armature*>& armatures) const;
+
+    void _benchmarkParse(const SyntheticSkeleton& skeleton, const std::string& rawData, std::ostringstream& result) const;
+    void _benchmarkBuild(const SyntheticSkeleton& skeleton, std::ostringstream& result) const;
+    void _benchmarkAdvanceTime(const SyntheticSkeleton& skeleton, bool cacheEnabled, unsigned stateCount, std::ostringstream& result) const;
+    void _benchmarkCacheFormat(const SyntheticSkeleton& skeleton, const std::string& rawData, dragonBones::CacheFrameFormat format, bool deduplication, std::ostringstream& result) const;
+    void _benchmarkSkinning(const SyntheticSkeleton& skeleton, std::ostringstream& result) const;
+    void _benchmarkContainsPoint(const SyntheticSkeleton& skeleton, std::ostringstream& result) const;
+    void _benchmarkTrigonometry(std::ostringstream& result) const;
+    void _benchmarkClockChurn(std::ostringstream& result) const;
+    double _measureTickTime(std::vector<dragonBones::Armature*>& armatures, unsigned& frameCount) const;
+};
+
+#endif // __BENCHMARK_H__
@@ -0,0 +1,197 @@
+#include "SyntheticSkeleton.h"
+
+#include <algorithm>
+#include <sstream>
+
+static const float BONE_LENGTH = 40.0f;
+static const float BONE_SPREAD = 12.0f;
+static const float BOUNDS_PADDING = 20.0f;
+static const unsigned FRAME_COUNT = 24;
+
+SyntheticSkeleton::SyntheticSkeleton(const std::string& pname, unsigned pboneCount, unsigned pmeshVertexCount, unsigned panimationCount) :
+    name(pname),
+    boneCount(pboneCount > 0 ? pboneCount : 1),
+    meshVertexCount(pmeshVertexCount < 3 ? 3 : pmeshVertexCount),
+    animationCount(panimationCount > 0 ? panimationCount : 1),
+    width(0.0f),
+    height(0.0f),
+    _minX(0.0f),
+    _minY(0.0f)
+{
+    auto maxX = 0.0f;
+    auto maxY = 0.0f;
+    for (unsigned i = 0; i < boneCount; ++i)
+    {
+        auto x = 0.0f;
+        auto y = 0.0f;
+        _getBonePosition(i, x, y);
+        _minX = std::min(_minX, x);
+        _minY = std::min(_minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+
+    _minX -= BOUNDS_PADDING;
+    _minY -= BOUNDS_PADDING;
+    width = maxX + BOUNDS_PADDING - _minX;
+    height = maxY + BOUNDS_PADDING - _minY;
+}
+
+unsigned SyntheticSkeleton::_getParentIndex(unsigned boneIndex) const
+{
+    return (boneIndex - 1) / 2;
+}
+
+void SyntheticSkeleton::_getBonePosition(unsigned boneIndex, float& x, float& y) const
+{
+    x = 0.0f;
+    y = 0.0f;
+    while (boneIndex > 0) // Setup pose has no rotation, so the global position is the sum of the local positions.
+    {
+        x += BONE_LENGTH;
+        y += boneIndex % 2 == 0 ? BONE_SPREAD : -BONE_SPREAD;
+        boneIndex = _getParentIndex(boneIndex);
+    }
+}
+
+unsigned SyntheticSkeleton::getSlotCount() const
+{
+    return boneCount + getBoundingBoxCount() + 1;
+}
+
+unsigned SyntheticSkeleton::getBoundingBoxCount() const
+{
+    return (boneCount + 3) / 4;
+}
+
+std::string SyntheticSkeleton::getMeshSlotName() const
+{
+    return "mesh";
+}
+
+std::string SyntheticSkeleton::getAnimationName(unsigned index) const
+{
+    return "a" + std::to_string(index);
+}
+
+std::string SyntheticSkeleton::createDragonBonesData() const
+{
+    std::ostringstream stream;
+    stream << "{\"name\":\"" << name << "\",\"version\":\"5.0\",\"compatibleVersion\":\"5.0\",\"frameRate\":24,\"armature\":[{";
+    stream << "\"type\":\"Armature\",\"name\":\"" << name << "\",\"frameRate\":24,";
+    stream << "\"aabb\":{\"x\":" << _minX << ",\"y\":" << _minY << ",\"width\":" << width << ",\"height\":" << height << "},";
+
+    stream << "\"bone\":[";
+    for (unsigned i = 0; i < boneCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << "{\"name\":\"b" << i << "\"";
+        if (i > 0)
+        {
+            stream << ",\"parent\":\"b" << _getParentIndex(i) << "\",\"transform\":{\"x\":" << BONE_LENGTH << ",\"y\":" << (i % 2 == 0 ? BONE_SPREAD : -BONE_SPREAD) << "}";
+        }
+
+        stream << "}";
+    }
+
+    stream << "],\"slot\":[";
+    for (unsigned i = 0; i < boneCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << "{\"name\":\"s" << i << "\",\"parent\":\"b" << i << "\"}";
+    }
+
+    for (unsigned i = 0; i < boneCount; i += 4)
+    {
+        stream << ",{\"name\":\"h" << i << "\",\"parent\":\"b" << i << "\"}";
+    }
+
+    stream << ",{\"name\":\"" << getMeshSlotName() << "\",\"parent\":\"b0\"}";
+
+    stream << "],\"skin\":[{\"name\":\"default\",\"slot\":[";
+    for (unsigned i = 0; i < boneCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << "{\"name\":\"s" << i << "\",\"display\":[{\"name\":\"image\"}]}";
+    }
+
+    for (unsigned i = 0; i < boneCount; i += 4)
+    {
+        stream << ",{\"name\":\"h" << i << "\",\"display\":[{\"type\":\"boundingBox\",\"subType\":\"rectangle\",\"name\":\"hit\",\"width\":24,\"height\":24}]}";
+    }
+
+    // Each vertex is weighted to one bone and its parent, the vertices of a bone are placed around it.
+    const auto rowCount = (meshVertexCount + boneCount - 1) / boneCount;
+    stream << ",{\"name\":\"" << getMeshSlotName() << "\",\"display\":[{\"type\":\"mesh\",\"name\":\"skin\",\"vertices\":[";
+    for (unsigned i = 0; i < meshVertexCount; ++i)
+    {
+        auto x = 0.0f;
+        auto y = 0.0f;
+        const auto row = i / boneCount;
+        _getBonePosition(i % boneCount, x, y);
+        stream << (i > 0 ? "," : "") << x + (row % 2 == 0 ? -5.0f : 5.0f) << "," << y + ((row / 2) % 2 == 0 ? -5.0f : 5.0f);
+    }
+
+    stream << "],\"uvs\":[";
+    for (unsigned i = 0; i < meshVertexCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << (float)(i % boneCount) / boneCount << "," << (float)(i / boneCount) / rowCount;
+    }
+
+    stream << "],\"triangles\":[";
+    for (unsigned i = 0; i + 2 < meshVertexCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << i << "," << i + 1 << "," << i + 2;
+    }
+
+    stream << "],\"weights\":[";
+    for (unsigned i = 0; i < meshVertexCount; ++i)
+    {
+        const auto boneIndex = i % boneCount;
+        if (boneIndex > 0)
+        {
+            stream << (i > 0 ? "," : "") << "2," << boneIndex << ",0.6," << _getParentIndex(boneIndex) << ",0.4";
+        }
+        else
+        {
+            stream << (i > 0 ? "," : "") << "1,0,1";
+        }
+    }
+
+    stream << "],\"slotPose\":[1,0,0,1,0,0],\"bonePose\":[";
+    for (unsigned i = 0; i < boneCount; ++i)
+    {
+        auto x = 0.0f;
+        auto y = 0.0f;
+        _getBonePosition(i, x, y);
+        stream << (i > 0 ? "," : "") << i << ",1,0,0,1," << x << "," << y;
+    }
+
+    stream << "]}]}]}],\"animation\":[";
+    for (unsigned i = 0; i < animationCount; ++i)
+    {
+        stream << (i > 0 ? "," : "") << "{\"name\":\"" << getAnimationName(i) << "\",\"duration\":" << FRAME_COUNT << ",\"playTimes\":0,\"bone\":[";
+        for (unsigned j = 0; j < boneCount; ++j)
+        {
+            const int degree = (int)((j * 7 + i * 13) % 31) - 15;
+            stream << (j > 0 ? "," : "") << "{\"name\":\"b" << j << "\",\"frame\":[";
+            stream << "{\"duration\":" << FRAME_COUNT / 2 << ",\"tweenEasing\":0,\"transform\":{}},";
+            stream << "{\"duration\":" << FRAME_COUNT / 2 << ",\"tweenEasing\":0,\"transform\":{\"skX\":" << degree << ",\"skY\":" << degree << "}}";
+            stream << "]}";
+        }
+
+        stream << "]}";
+    }
+
+    stream << "]}]}";
+
+    return stream.str();
+}
+
+std::string SyntheticSkeleton::createTextureAtlasData() const
+{
+    std::ostringstream stream;
+    stream << "{\"name\":\"" << name << "\",\"imagePath\":\"" << name << ".png\",\"width\":64,\"height\":32,\"SubTexture\":[";
+    stream << "{\"name\":\"image\",\"x\":0,\"y\":0,\"width\":32,\"height\":32},";
+    stream << "{\"name\":\"skin\",\"x\":32,\"y\":0,\"width\":32,\"height\":32}";
+    stream << "]}";
+
+    return stream.str();
+}
@@ -0,0 +1,39 @@
+#ifndef __SYNTHETIC_SKELETON_H__
+#define __SYNTHETIC_SKELETON_H__
+
+#include <string>
+
+/**
+ * Generates DragonBones 5.0 JSON data for benchmarks, so the results do not depend on any asset.
+ * The armature is a binary tree of bones with one image slot per bone, a rectangle bounding box slot on every fourth bone
+ * and a mesh slot skinned to all bones. Every animation rotates every bone.
+ */
+class SyntheticSkeleton
+{
+public:
+    std::string name;
+    unsigned boneCount;
+    unsigned meshVertexCount;
+    unsigned animationCount;
+    float width;
+    float height;
+
+    SyntheticSkeleton(const std::string& name, unsigned boneCount, unsigned meshVertexCount, unsigned animationCount);
+
+    unsigned getSlotCount() const;
+    unsigned getBoundingBoxCount() const;
+    std::string getMeshSlotName() const;
+    std::string getAnimationName(unsigned index) const;
+
+    std::string createDragonBonesData() const;
+    std::string createTextureAtlasData() const;
+
+private:
+    float _minX;
+    float _minY;
+
+    unsigned _getParentIndex(unsigned boneIndex) const;
+    void _getBonePosition(unsigned boneIndex, float& x, float& y) const;
+};
+
+#endif // __SYNTHETIC_SKELETON_H__
@@ -0,0 +1,52 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "Benchmark.h"
+
+/**
+ * Usage: Benchmark [--bones=10,50,100,250,500] [--time=0.5] [output.json]
+ * Results are written to stdout if no output file is set.
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<unsigned> boneCounts = { 10, 50, 100, 250, 500 };
+    std::string outputPath;
+    Benchmark benchmark;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg.compare(0, 8, "--bones=") == 0)
+        {
+            boneCounts.clear();
+            std::istringstream stream(arg.substr(8));
+            std::string value;
+            while (std::getline(stream, value, ','))
+            {
+                boneCounts.push_back((unsigned)std::strtoul(value.c_str(), nullptr, 10));
+            }
+        }
+        else if (arg.compare(0, 7, "--time=") == 0)
+        {
+            benchmark.minTime = (float)std::atof(arg.c_str() + 7);
+        }
+        else
+        {
+            outputPath = arg;
+        }
+    }
+
+    const auto result = benchmark.run(boneCounts);
+    if (outputPath.empty())
+    {
+        std::cout << result << std::endl;
+    }
+    else
+    {
+        std::ofstream file(outputPath);
+        file << result << std::endl;
+    }
+
+    return benchmark.checksPassed ? 0 : 1;
+}
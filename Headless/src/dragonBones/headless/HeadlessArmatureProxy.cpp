@@ -0,0 +1,81 @@
+#include "HeadlessArmatureProxy.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+void HeadlessArmatureProxy::_init(Armature* armature)
+{
+    _armature = armature;
+}
+
+void HeadlessArmatureProxy::clear()
+{
+    _armature = nullptr;
+    _listeners.clear();
+
+    delete this;
+}
+
+void HeadlessArmatureProxy::dispose(bool disposeProxy)
+{
+    if (_armature != nullptr)
+    {
+        _armature->dispose();
+        _armature = nullptr;
+    }
+}
+
+void HeadlessArmatureProxy::debugUpdate(bool isEnabled)
+{
+    // No debug draw.
+}
+
+void HeadlessArmatureProxy::_dispatchEvent(const std::string& type, EventObject* value)
+{
+    const auto iterator = _listeners.find(type);
+    if (iterator == _listeners.cend())
+    {
+        return;
+    }
+
+    const auto listeners = iterator->second; // Copy, listeners can be changed by listeners.
+    for (const auto& listener : listeners)
+    {
+        listener(value);
+    }
+}
+
+void HeadlessArmatureProxy::addEvent(const std::string& type, const std::function<void(EventObject*)>& listener)
+{
+    _listeners[type].push_back(listener);
+}
+
+void HeadlessArmatureProxy::removeEvent(const std::string& type, const std::function<void(EventObject*)>& listener)
+{
+    // std::function can not be compared, remove all listeners of the type.
+    _listeners.erase(type);
+}
+
+void HeadlessArmatureProxy::getBoneMatrices(std::vector<float>& result) const
+{
+    result.clear();
+    if (_armature == nullptr)
+    {
+        return;
+    }
+
+    const auto& bones = _armature->getBones();
+    result.resize(bones.size() * 6);
+    for (std::size_t i = 0, l = bones.size(); i < l; ++i)
+    {
+        const auto& matrix = bones[i]->globalTransformMatrix;
+        const auto values = result.data() + i * 6;
+        values[0] = matrix.a;
+        values[1] = matrix.b;
+        values[2] = matrix.c;
+        values[3] = matrix.d;
+        values[4] = matrix.tx;
+        values[5] = matrix.ty;
+    }
+}
+
+DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,88 @@
+#ifndef DRAGONBONES_HEADLESS_ARMATURE_PROXY_H
+#define DRAGONBONES_HEADLESS_ARMATURE_PROXY_H
+
+#include "dragonBones/DragonBonesHeaders.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 无渲染的骨架代理，同时作为骨架的显示容器和事件派发器。
+* @see dragonBones.HeadlessSlot
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessArmatureProxy : public virtual IArmatureProxy
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(HeadlessArmatureProxy)
+
+protected:
+    Armature* _armature;
+    std::map<std::string, std::vector<std::function<void(EventObject*)>>> _listeners;
+
+public:
+    HeadlessArmatureProxy() :
+        _armature(nullptr),
+        _listeners()
+    {}
+    virtual ~HeadlessArmatureProxy() {}
+
+public:
+    /**
+    * @inheritDoc
+    */
+    virtual void _init(Armature* armature) override;
+    /**
+    * @inheritDoc
+    */
+    virtual void clear() override;
+    /**
+    * @inheritDoc
+    */
+    virtual void dispose(bool disposeProxy = true) override;
+    /**
+    * @inheritDoc
+    */
+    virtual void debugUpdate(bool isEnabled) override;
+    /**
+    * @inheritDoc
+    */
+    virtual void _dispatchEvent(const std::string& type, EventObject* value) override;
+    /**
+    * @inheritDoc
+    */
+    virtual void addEvent(const std::string& type, const std::function<void(EventObject*)>& listener) override;
+    /**
+    * @inheritDoc
+    */
+    virtual void removeEvent(const std::string& type, const std::function<void(EventObject*)>& listener) override;
+    /**
+    * @inheritDoc
+    */
+    inline virtual bool hasEvent(const std::string& type) const override
+    {
+        return _listeners.find(type) != _listeners.cend();
+    }
+    /**
+    * @inheritDoc
+    */
+    inline virtual Armature* getArmature() const override
+    {
+        return _armature;
+    }
+    /**
+    * @inheritDoc
+    */
+    inline virtual Animation* getAnimation() const override
+    {
+        return _armature->getAnimation();
+    }
+    /**
+    * 获取所有骨骼的全局矩阵，每个骨骼按 a, b, c, d, tx, ty 存储，顺序同 Armature::getBones()。
+    * @param result 全局矩阵。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    void getBoneMatrices(std::vector<float>& result) const;
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_HEADLESS_ARMATURE_PROXY_H
@@ -0,0 +1,9 @@
+#ifndef DRAGONBONES_HEADLESS_HEADERS_H
+#define DRAGONBONES_HEADLESS_HEADERS_H
+
+#include "HeadlessTextureAtlasData.h"
+#include "HeadlessArmatureProxy.h"
+#include "HeadlessSlot.h"
+#include "HeadlessFactory.h"
+
+#endif // DRAGONBONES_HEADLESS_HEADERS_H
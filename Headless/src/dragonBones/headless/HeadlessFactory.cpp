@@ -0,0 +1,152 @@
+#include "HeadlessFactory.h"
+#include "HeadlessTextureAtlasData.h"
+#include "HeadlessArmatureProxy.h"
+#include "HeadlessSlot.h"
+#include <fstream>
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+DragonBones* HeadlessFactory::_dragonBonesInstance = nullptr;
+HeadlessFactory* HeadlessFactory::_factory = nullptr;
+
+static bool _readFile(const std::string& filePath, std::string& result)
+{
+    std::ifstream file(filePath, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    result = stream.str();
+
+    return !result.empty();
+}
+
+TextureAtlasData* HeadlessFactory::_buildTextureAtlasData(TextureAtlasData* textureAtlasData, void* textureAtlas) const
+{
+    if (textureAtlasData != nullptr)
+    {
+        const auto pos = _prevPath.find_last_of("/");
+        if (std::string::npos != pos)
+        {
+            const auto basePath = _prevPath.substr(0, pos + 1);
+            textureAtlasData->imagePath = basePath + textureAtlasData->imagePath;
+        }
+
+        static_cast<HeadlessTextureAtlasData*>(textureAtlasData)->renderTexture = textureAtlas;
+    }
+    else
+    {
+        textureAtlasData = BaseObject::borrowObject<HeadlessTextureAtlasData>();
+    }
+
+    return textureAtlasData;
+}
+
+Armature* HeadlessFactory::_buildArmature(const BuildArmaturePackage& dataPackage) const
+{
+    const auto armature = BaseObject::borrowObject<Armature>();
+    const auto armatureProxy = new HeadlessArmatureProxy(); // Deleted by HeadlessArmatureProxy::clear().
+
+    armature->init(
+        dataPackage.armature,
+        armatureProxy, armatureProxy, _dragonBones
+    );
+
+    return armature;
+}
+
+Slot* HeadlessFactory::_buildSlot(const BuildArmaturePackage& dataPackage, SlotData* slotData, std::vector<DisplayData*>* displays, Armature& armature) const
+{
+    const auto slot = BaseObject::borrowObject<HeadlessSlot>();
+    const auto rawDisplay = new HeadlessDisplay(); // Raw display and mesh display are the same display.
+
+    rawDisplay->_refCount = 1; // Released by Slot::_onClear().
+    rawDisplay->zOrder = slotData->zOrder;
+
+    slot->init(
+        slotData, displays,
+        rawDisplay, rawDisplay
+    );
+
+    return slot;
+}
+
+std::size_t HeadlessFactory::_getSlotClassTypeIndex() const
+{
+    return HeadlessSlot::getTypeIndex();
+}
+
+DragonBonesData* HeadlessFactory::loadDragonBonesData(const std::string& filePath, const std::string& dragonBonesName)
+{
+    if (!dragonBonesName.empty())
+    {
+        const auto existedData = getDragonBonesData(dragonBonesName);
+        if (existedData)
+        {
+            return existedData;
+        }
+    }
+
+    std::string fileData;
+    if (!_readFile(filePath, fileData))
+    {
+        return nullptr;
+    }
+
+    if (
+        fileData.size() > 4 &&
+        fileData[0] == 'D' &&
+        fileData[1] == 'B' &&
+        fileData[2] == 'D' &&
+        fileData[3] == 'T'
+    )
+    {
+        const auto buffer = (char*)malloc(sizeof(char) * fileData.size());
+        memcpy(buffer, fileData.data(), fileData.size());
+        const auto data = parseDragonBonesData(buffer, dragonBonesName, 1.0f);
+        if (data != nullptr)
+        {
+            data->buffer = buffer;
+            data->contentHash = AnimationCacheFile::getContentHash(buffer, fileData.size(), 1.0f);
+        }
+        else
+        {
+            free(buffer);
+        }
+
+        return data;
+    }
+
+    return parseDragonBonesData(fileData.c_str(), dragonBonesName, 1.0f);
+}
+
+TextureAtlasData* HeadlessFactory::loadTextureAtlasData(const std::string& filePath, const std::string& dragonBonesName, float scale)
+{
+    _prevPath = filePath;
+
+    std::string fileData;
+    if (!_readFile(filePath, fileData))
+    {
+        return nullptr;
+    }
+
+    return BaseFactory::parseTextureAtlasData(fileData.c_str(), nullptr, dragonBonesName, scale);
+}
+
+HeadlessArmatureProxy* HeadlessFactory::buildArmatureProxy(const std::string& armatureName, const std::string& dragonBonesName, const std::string& skinName, const std::string& textureAtlasName) const
+{
+    const auto armature = buildArmature(armatureName, dragonBonesName, skinName, textureAtlasName);
+    if (armature != nullptr)
+    {
+        const auto armatureProxy = static_cast<HeadlessArmatureProxy*>(armature->getDisplay());
+        _dragonBones->getClock()->add(armature);
+        return armatureProxy;
+    }
+
+    return nullptr;
+}
+
+DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,138 @@
+#ifndef DRAGONBONES_HEADLESS_FACTORY_H
+#define DRAGONBONES_HEADLESS_FACTORY_H
+
+#include "dragonBones/DragonBonesHeaders.h"
+#include "HeadlessArmatureProxy.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 无渲染的工厂，不依赖任何引擎，用于服务器、工具和性能测试。
+* 骨骼、插槽、网格顶点、颜色和显示对象的索引都更新到普通的缓冲区中。
+* @see dragonBones.HeadlessArmatureProxy
+* @see dragonBones.HeadlessDisplay
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessFactory : public BaseFactory
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(HeadlessFactory)
+
+protected:
+    static DragonBones* _dragonBonesInstance;
+    static HeadlessFactory* _factory;
+
+public:
+    /**
+    * 一个可以直接使用的全局 WorldClock 实例。 (由 advanceTime() 驱动)
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    static WorldClock* getClock()
+    {
+        return _dragonBonesInstance->getClock();
+    }
+    /**
+    * 一个可以直接使用的全局工厂实例。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    static HeadlessFactory* getFactory()
+    {
+        if (HeadlessFactory::_factory == nullptr)
+        {
+            HeadlessFactory::_factory = new HeadlessFactory();
+        }
+
+        return HeadlessFactory::_factory;
+    }
+    /**
+    * 为全局 WorldClock 更新时间并派发事件，发布烘焙完成的帧缓存，没有引擎驱动时需要每帧调用。
+    * @param passedTime 前进的时间。 (以秒为单位)
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    static void advanceTime(float passedTime)
+    {
+        if (_factory != nullptr)
+        {
+            _factory->publishBakedAnimations();
+        }
+
+        _dragonBonesInstance->advanceTime(passedTime);
+#ifdef DRAGONBONES_PROFILE
+        _dragonBonesInstance->endProfileFrame();
+        TraceRecorder::endFrame();
+#endif
+    }
+
+protected:
+    std::string _prevPath;
+
+public:
+    /**
+    * @inheritDoc
+    */
+    HeadlessFactory() :
+        _prevPath()
+    {
+        if (_dragonBonesInstance == nullptr)
+        {
+            const auto eventManager = new HeadlessArmatureProxy();
+            _dragonBonesInstance = new DragonBones(eventManager);
+            _dragonBonesInstance->displayThreadSafe = true; // Headless slots have no display.
+        }
+
+        _dragonBones = _dragonBonesInstance;
+    }
+    virtual ~HeadlessFactory()
+    {
+    }
+
+protected:
+    virtual TextureAtlasData* _buildTextureAtlasData(TextureAtlasData* textureAtlasData, void* textureAtlas) const override;
+    virtual Armature* _buildArmature(const BuildArmaturePackage& dataPackage) const override;
+    virtual Slot* _buildSlot(const BuildArmaturePackage& dataPackage, SlotData* slotData, std::vector<DisplayData*>* displays, Armature& armature) const override;
+    virtual std::size_t _getSlotClassTypeIndex() const override;
+
+public:
+    /**
+    * 加载并解析龙骨数据。 (JSON 或二进制)
+    * @param filePath 文件路径。
+    * @param name 为数据提供一个名称，如果未设置，则使用数据中的名称。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual DragonBonesData* loadDragonBonesData(const std::string& filePath, const std::string& name = "");
+    /**
+    * 加载并解析贴图集数据，不加载图片。
+    * @param filePath 文件路径。
+    * @param name 为数据提供一个名称，如果未设置，则使用数据中的名称。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual TextureAtlasData* loadTextureAtlasData(const std::string& filePath, const std::string& name = "", float scale = 0.0f);
+    /**
+    * 创建一个指定名称的骨架，并添加到全局 WorldClock。
+    * @param armatureName 骨架名称。
+    * @param dragonBonesName 龙骨数据名称，如果未设置，将检索所有的龙骨数据，如果多个数据中包含同名的骨架数据，可能无法创建出准确的骨架。
+    * @param skinName 皮肤名称，如果未设置，则使用默认皮肤。
+    * @param textureAtlasName 贴图集数据名称，如果未设置，则使用龙骨数据。
+    * @returns 骨架的代理。
+    * @see dragonBones.HeadlessArmatureProxy
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual HeadlessArmatureProxy* buildArmatureProxy(const std::string& armatureName, const std::string& dragonBonesName = "", const std::string& skinName = "", const std::string& textureAtlasName = "") const;
+    /**
+    * 获取全局事件管理器。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    virtual HeadlessArmatureProxy* getEventManager() const
+    {
+        return dynamic_cast<HeadlessArmatureProxy*>(static_cast<IArmatureProxy*>(_dragonBones->getEventManager()));
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_HEADLESS_FACTORY_H
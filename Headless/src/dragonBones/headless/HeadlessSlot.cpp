@@ -0,0 +1,273 @@
+#include "HeadlessSlot.h"
+#include "HeadlessTextureAtlasData.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+void HeadlessSlot::_onClear()
+{
+    Slot::_onClear();
+
+    _renderDisplay = nullptr;
+}
+
+void HeadlessSlot::_initDisplay(void* value)
+{
+    const auto renderDisplay = static_cast<HeadlessDisplay*>(value);
+    renderDisplay->_refCount++;
+}
+
+void HeadlessSlot::_disposeDisplay(void* value)
+{
+    const auto renderDisplay = static_cast<HeadlessDisplay*>(value);
+    if (renderDisplay->_refCount <= 1)
+    {
+        delete renderDisplay;
+    }
+    else
+    {
+        renderDisplay->_refCount--;
+    }
+}
+
+void HeadlessSlot::_onUpdateDisplay()
+{
+    if (_childArmature != nullptr) // Child armature updates its own displays.
+    {
+        _renderDisplay = nullptr;
+    }
+    else
+    {
+        _renderDisplay = static_cast<HeadlessDisplay*>(_display != nullptr ? _display : _rawDisplay);
+    }
+}
+
+void HeadlessSlot::_addDisplay()
+{
+    // No display list.
+}
+
+void HeadlessSlot::_replaceDisplay(void* value, bool isArmatureDisplayContainer)
+{
+    if (_renderDisplay != nullptr && !isArmatureDisplayContainer)
+    {
+        _renderDisplay->zOrder = static_cast<HeadlessDisplay*>(value)->zOrder;
+    }
+}
+
+void HeadlessSlot::_removeDisplay()
+{
+    // No display list.
+}
+
+void HeadlessSlot::_updateZOrder()
+{
+    if (_renderDisplay != nullptr)
+    {
+        _renderDisplay->zOrder = _zOrder;
+    }
+}
+
+void HeadlessSlot::_updateVisible()
+{
+    if (_renderDisplay != nullptr)
+    {
+        _renderDisplay->visible = _parent->getVisible();
+    }
+}
+
+void HeadlessSlot::_updateBlendMode()
+{
+    if (_renderDisplay != nullptr)
+    {
+        _renderDisplay->blendMode = _blendMode;
+    }
+    else if (_childArmature != nullptr)
+    {
+        for (const auto slot : _childArmature->getSlots())
+        {
+            slot->_blendMode = _blendMode;
+            slot->_updateBlendMode();
+        }
+    }
+}
+
+void HeadlessSlot::_updateColor()
+{
+    if (_renderDisplay != nullptr)
+    {
+        _renderDisplay->color = _colorTransform; // Copy.
+    }
+}
+
+void HeadlessSlot::_updateFrame()
+{
+    if (_renderDisplay == nullptr)
+    {
+        return;
+    }
+
+    const auto meshData = _display == _meshDisplay ? _meshData : nullptr;
+    const auto currentTextureData = _textureData;
+    auto& display = *_renderDisplay;
+    display.displayIndex = _displayIndex;
+    display.vertices.clear();
+    display.uvs.clear();
+    display.indices.clear();
+
+    if (_displayIndex >= 0 && _display != nullptr && currentTextureData != nullptr)
+    {
+        const auto& region = currentTextureData->region;
+        const auto textureAtlasData = currentTextureData->parent;
+        const auto textureAtlasWidth = textureAtlasData->width > 0 ? (float)textureAtlasData->width : 1.0f;
+        const auto textureAtlasHeight = textureAtlasData->height > 0 ? (float)textureAtlasData->height : 1.0f;
+        display.texture = currentTextureData;
+
+        if (meshData != nullptr) // Mesh.
+        {
+            const auto intArray = meshData->parent->parent->intArray;
+            const auto floatArray = meshData->parent->parent->floatArray;
+            const unsigned vertexCount = intArray[meshData->offset + (unsigned)BinaryOffset::MeshVertexCount];
+            const unsigned triangleCount = intArray[meshData->offset + (unsigned)BinaryOffset::MeshTriangleCount];
+            const unsigned verticesOffset = intArray[meshData->offset + (unsigned)BinaryOffset::MeshFloatOffset];
+            const unsigned uvOffset = verticesOffset + vertexCount * 2;
+
+            display.vertices.resize(vertexCount * 2);
+            display.uvs.resize(vertexCount * 2);
+            display.indices.resize(triangleCount * 3);
+
+            for (std::size_t i = 0, l = vertexCount * 2; i < l; i += 2)
+            {
+                display.vertices[i] = floatArray[verticesOffset + i];
+                display.vertices[i + 1] = floatArray[verticesOffset + i + 1];
+                display.uvs[i] = (region.x + floatArray[uvOffset + i] * region.width) / textureAtlasWidth;
+                display.uvs[i + 1] = (region.y + floatArray[uvOffset + i + 1] * region.height) / textureAtlasHeight;
+            }
+
+            for (std::size_t i = 0; i < triangleCount * 3; ++i)
+            {
+                display.indices[i] = intArray[meshData->offset + (unsigned)BinaryOffset::MeshVertexIndices + i];
+            }
+        }
+        else // Normal texture.
+        {
+            const auto scale = _armature->armatureData->scale;
+            const auto width = (currentTextureData->rotated ? region.height : region.width) * scale;
+            const auto height = (currentTextureData->rotated ? region.width : region.height) * scale;
+            const auto uL = region.x / textureAtlasWidth;
+            const auto uR = (region.x + region.width) / textureAtlasWidth;
+            const auto vT = region.y / textureAtlasHeight;
+            const auto vB = (region.y + region.height) / textureAtlasHeight;
+
+            display.vertices = { 0.0f, 0.0f, width, 0.0f, width, height, 0.0f, height };
+            if (currentTextureData->rotated) // Clockwise 90 degrees in the texture atlas.
+            {
+                display.uvs = { uR, vT, uR, vB, uL, vB, uL, vT };
+            }
+            else
+            {
+                display.uvs = { uL, vT, uR, vT, uR, vB, uL, vB };
+            }
+
+            display.indices = { 0, 1, 2, 0, 2, 3 };
+        }
+
+        _blendModeDirty = true;
+        _colorDirty = true;
+        return;
+    }
+
+    display.texture = nullptr;
+}
+
+void HeadlessSlot::_updateMesh()
+{
+    if (_renderDisplay == nullptr)
+    {
+        return;
+    }
+
+    DRAGONBONES_PROFILE_NAMED_SCOPE(_armature->_dragonBones, Mesh, name);
+
+    const auto hasFFD = !_ffdVertices.empty();
+    const auto meshData = _meshData;
+    const auto weightData = meshData->weight;
+    auto& vertices = _renderDisplay->vertices;
+
+    if (weightData != nullptr)
+    {
+        const auto intArray = meshData->parent->parent->intArray;
+        const auto floatArray = meshData->parent->parent->floatArray;
+        const auto vertexCount = (std::size_t)intArray[meshData->offset + (unsigned)BinaryOffset::MeshVertexCount];
+        const auto weightFloatOffset = (std::size_t)intArray[weightData->offset + (unsigned)BinaryOffset::WeigthFloatOffset];
+        vertices.resize(vertexCount * 2);
+
+        for (
+            std::size_t i = 0, iB = weightData->offset + (unsigned)BinaryOffset::WeigthBoneIndices + weightData->bones.size(), iV = weightFloatOffset, iF = 0;
+            i < vertexCount;
+            ++i
+        )
+        {
+            const auto boneCount = (std::size_t)intArray[iB++];
+            auto xG = 0.0f, yG = 0.0f;
+            for (std::size_t j = 0; j < boneCount; ++j)
+            {
+                const auto boneIndex = (unsigned)intArray[iB++];
+                const auto bone = _meshBones[boneIndex];
+                if (bone != nullptr)
+                {
+                    const auto& matrix = bone->globalTransformMatrix;
+                    const auto weight = floatArray[iV++];
+                    auto xL = floatArray[iV++];
+                    auto yL = floatArray[iV++];
+
+                    if (hasFFD)
+                    {
+                        xL += _ffdVertices[iF++];
+                        yL += _ffdVertices[iF++];
+                    }
+
+                    xG += (matrix.a * xL + matrix.c * yL + matrix.tx) * weight;
+                    yG += (matrix.b * xL + matrix.d * yL + matrix.ty) * weight;
+                }
+            }
+
+            vertices[i * 2] = xG;
+            vertices[i * 2 + 1] = yG;
+        }
+    }
+    else if (hasFFD)
+    {
+        const auto intArray = meshData->parent->parent->intArray;
+        const auto floatArray = meshData->parent->parent->floatArray;
+        const auto vertexCount = (std::size_t)intArray[meshData->offset + (unsigned)BinaryOffset::MeshVertexCount];
+        const auto vertexOffset = (std::size_t)intArray[meshData->offset + (unsigned)BinaryOffset::MeshFloatOffset];
+        vertices.resize(vertexCount * 2);
+
+        for (std::size_t i = 0, l = vertexCount * 2; i < l; ++i)
+        {
+            vertices[i] = floatArray[vertexOffset + i] + _ffdVertices[i];
+        }
+    }
+}
+
+void HeadlessSlot::_updateTransform(bool isSkinnedMesh)
+{
+    if (_renderDisplay == nullptr)
+    {
+        return;
+    }
+
+    auto& transform = _renderDisplay->transform;
+    if (isSkinnedMesh) // Identity transform.
+    {
+        transform.identity();
+    }
+    else
+    {
+        transform = globalTransformMatrix; // Copy.
+        transform.tx = globalTransformMatrix.tx - (globalTransformMatrix.a * _pivotX + globalTransformMatrix.c * _pivotY);
+        transform.ty = globalTransformMatrix.ty - (globalTransformMatrix.b * _pivotX + globalTransformMatrix.d * _pivotY);
+    }
+}
+
+DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,123 @@
+#ifndef DRAGONBONES_HEADLESS_SLOT_H
+#define DRAGONBONES_HEADLESS_SLOT_H
+
+#include "dragonBones/DragonBonesHeaders.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 无渲染的显示对象，保存插槽更新后的显示状态。
+* 坐标使用龙骨的坐标系，相对于骨架的显示容器。
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessDisplay
+{
+    DRAGONBONES_DISALLOW_COPY_AND_ASSIGN(HeadlessDisplay)
+
+public:
+    /**
+    * @private
+    */
+    unsigned _refCount;
+    /**
+    * 是否可见。
+    */
+    bool visible;
+    /**
+    * 显示对象的索引。
+    */
+    int displayIndex;
+    /**
+    * 显示顺序。
+    */
+    int zOrder;
+    /**
+    * 混合模式。
+    */
+    BlendMode blendMode;
+    /**
+    * 颜色变换。
+    */
+    ColorTransform color;
+    /**
+    * 显示对象的变换矩阵，已包含轴点。 (蒙皮网格为单位矩阵，顶点已经是骨架坐标)
+    */
+    Matrix transform;
+    /**
+    * 贴图，没有贴图时为 nullptr。
+    */
+    TextureData* texture;
+    /**
+    * 顶点坐标，每个顶点按 x, y 存储。 (图片为贴图区域的四个角)
+    */
+    std::vector<float> vertices;
+    /**
+    * 顶点的贴图坐标，每个顶点按 u, v 存储，相对于贴图集的尺寸。
+    */
+    std::vector<float> uvs;
+    /**
+    * 三角形的顶点索引。
+    */
+    std::vector<unsigned short> indices;
+
+    HeadlessDisplay() :
+        _refCount(0),
+        visible(true),
+        displayIndex(-1),
+        zOrder(0),
+        blendMode(BlendMode::Normal),
+        color(),
+        transform(),
+        texture(nullptr),
+        vertices(),
+        uvs(),
+        indices()
+    {}
+    ~HeadlessDisplay() {}
+};
+/**
+* 无渲染的插槽。
+* @see dragonBones.HeadlessDisplay
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessSlot : public Slot
+{
+    BIND_CLASS_TYPE_A(HeadlessSlot);
+
+private:
+    HeadlessDisplay* _renderDisplay;
+
+protected:
+    virtual void _onClear() override;
+
+    virtual void _initDisplay(void* value) override;
+    virtual void _disposeDisplay(void* value) override;
+    virtual void _onUpdateDisplay() override;
+    virtual void _addDisplay() override;
+    virtual void _replaceDisplay(void* value, bool isArmatureDisplayContainer) override;
+    virtual void _removeDisplay() override;
+    virtual void _updateZOrder() override;
+public:
+    virtual void _updateVisible() override;
+    virtual void _updateBlendMode() override;
+    virtual void _updateColor() override;
+protected:
+    virtual void _updateFrame() override;
+    virtual void _updateMesh() override;
+    virtual void _updateTransform(bool isSkinnedMesh) override;
+
+public:
+    /**
+    * 当前的显示对象，显示子骨架时为 nullptr。
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    inline const HeadlessDisplay* getRenderDisplay() const
+    {
+        return _renderDisplay;
+    }
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_HEADLESS_SLOT_H
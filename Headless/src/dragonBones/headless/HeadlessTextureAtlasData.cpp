@@ -0,0 +1,22 @@
+#include "HeadlessTextureAtlasData.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+
+void HeadlessTextureAtlasData::_onClear()
+{
+    TextureAtlasData::_onClear();
+
+    renderTexture = nullptr;
+}
+
+TextureData* HeadlessTextureAtlasData::createTexture() const
+{
+    return BaseObject::borrowObject<HeadlessTextureData>();
+}
+
+void HeadlessTextureData::_onClear()
+{
+    TextureData::_onClear();
+}
+
+DRAGONBONES_NAMESPACE_END
@@ -0,0 +1,58 @@
+#ifndef DRAGONBONES_HEADLESS_TEXTURE_ATLAS_DATA_H
+#define DRAGONBONES_HEADLESS_TEXTURE_ATLAS_DATA_H
+
+#include "dragonBones/DragonBonesHeaders.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+/**
+* 无渲染的贴图集数据，只保存贴图的区域，不加载图片。
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessTextureAtlasData : public TextureAtlasData
+{
+    BIND_CLASS_TYPE_B(HeadlessTextureAtlasData);
+
+public:
+    /**
+    * 由外部提供的贴图。 (可选，不会被释放)
+    * @version DragonBones 5.1
+    * @language zh_CN
+    */
+    void* renderTexture;
+
+public:
+    HeadlessTextureAtlasData() :
+        renderTexture(nullptr)
+    {
+        _onClear();
+    }
+    virtual ~HeadlessTextureAtlasData()
+    {
+        _onClear();
+    }
+
+protected:
+    virtual void _onClear() override;
+
+public:
+    /**
+    * @private
+    */
+    virtual TextureData* createTexture() const override;
+};
+/**
+* 无渲染的贴图数据。
+* @version DragonBones 5.1
+* @language zh_CN
+*/
+class HeadlessTextureData : public TextureData
+{
+    BIND_CLASS_TYPE_A(HeadlessTextureData);
+
+protected:
+    virtual void _onClear() override;
+};
+
+DRAGONBONES_NAMESPACE_END
+#endif // DRAGONBONES_HEADLESS_TEXTURE_ATLAS_DATA_H